@@ -129,7 +129,7 @@ std::shared_ptr<KHARMAPackage> B_CT::Initialize(ParameterInput *pin, std::shared
     pkg->AddSource = B_CT::AddSource;
 
     // Also ensure that prims get filled, both during step and on boundaries
-    //pkg->MeshUtoP = B_CT::MeshUtoP;
+    pkg->MeshUtoP = B_CT::MeshUtoP;
     pkg->BlockUtoP = B_CT::BlockUtoP;
     pkg->BoundaryUtoP = B_CT::BlockUtoP;
 
@@ -162,9 +162,34 @@ std::shared_ptr<KHARMAPackage> B_CT::Initialize(ParameterInput *pin, std::shared
 
 TaskStatus B_CT::MeshUtoP(MeshData<Real> *md, IndexDomain domain, bool coarse)
 {
-    // TODO later
-    for (int i=0; i < md->NumBlocks(); i++)
-        B_CT::BlockUtoP(md->GetBlockData(i).get(), domain, coarse);
+    auto pmb0 = md->GetBlockData(0)->GetBlockPointer();
+    const int ndim = pmb0->pmy_mesh->ndim;
+    auto B_Uf = md->PackVariables(std::vector<std::string>{"cons.fB"});
+    auto B_U = md->PackVariables(std::vector<std::string>{"cons.B"});
+    auto B_P = md->PackVariables(std::vector<std::string>{"prims.B"});
+    // Return if we're not syncing U & P at all (e.g. edges)
+    if (B_Uf.GetDim(4) == 0) return TaskStatus::complete;
+
+    const IndexRange3 bc = KDomain::GetRange(md, domain, coarse);
+    const IndexRange block = IndexRange{0, B_Uf.GetDim(5) - 1};
+
+    // Average the primitive vals to zone centers, and recover conserved B there
+    pmb0->par_for("UtoP_B_center", block.s, block.e, bc.ks, bc.ke, bc.js, bc.je, bc.is, bc.ie,
+        KOKKOS_LAMBDA (const int& b, const int &k, const int &j, const int &i) {
+            const auto& G = B_Uf.GetCoords(b);
+            B_P(b, V1, k, j, i) = (B_Uf(b, F1, 0, k, j, i) / G.gdet(Loci::face1, j, i)
+                                 + B_Uf(b, F1, 0, k, j, i + 1) / G.gdet(Loci::face1, j, i + 1)) / 2;
+            B_P(b, V2, k, j, i) = (ndim > 1) ? (B_Uf(b, F2, 0, k, j, i) / G.gdet(Loci::face2, j, i)
+                                              + B_Uf(b, F2, 0, k, j + 1, i) / G.gdet(Loci::face2, j + 1, i)) / 2
+                                              : B_Uf(b, F2, 0, k, j, i) / G.gdet(Loci::face2, j, i);
+            B_P(b, V3, k, j, i) = (ndim > 2) ? (B_Uf(b, F3, 0, k, j, i) / G.gdet(Loci::face3, j, i)
+                                              + B_Uf(b, F3, 0, k + 1, j, i) / G.gdet(Loci::face3, j, i)) / 2
+                                              : B_Uf(b, F3, 0, k, j, i) / G.gdet(Loci::face3, j, i);
+            const Real gdet = G.gdet(Loci::center, j, i);
+            VLOOP B_U(b, v, k, j, i) = B_P(b, v, k, j, i) * gdet;
+        }
+    );
+
     return TaskStatus::complete;
 }
 
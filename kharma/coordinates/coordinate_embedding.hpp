@@ -37,7 +37,9 @@
 
 #include "coordinate_systems.hpp"
 #include "coordinate_utils.hpp"
+#include "dual.hpp"
 #include "matrix.hpp"
+#include "tabulated_metric.hpp"
 
 // std::variant requires C++ exceptions,
 // so it will never be SYCL-ready.
@@ -74,6 +76,8 @@
  * * dxdX_to_native
  * 
  * Each possible class is added to a couple of mpark::variant containers, and then to the chains of if statements below.
+ * If KHARMA is compiled for a single system with FIXED_BASE & FIXED_TRANSFORM (see CMakeLists.txt), all dispatch
+ * through visit_base/visit_transform resolves at compile time, so the metric can be inlined into each kernel.
  *
  * TODO convenience functions.  Intelligent r/th/phi, x/y/z, KS and BL, a, etc by auto-translating contents
  */
@@ -81,6 +85,48 @@ class CoordinateEmbedding {
     public:
         SomeBaseCoords base;
         SomeTransform transform;
+        // Optional tabulated version of the base metric, see tabulated_metric.hpp.  Empty unless
+        // coordinates/tabulate_metric is set.  Kept out of the variants so they stay trivially copyable
+        TabulatedMetric table;
+
+        // Dispatch to the underlying base coordinates or transform.  All member functions should use these
+        // (or holds_base/holds_transform) rather than accessing the variants directly
+        template<typename F>
+        KOKKOS_FORCEINLINE_FUNCTION decltype(auto) visit_base(F&& f) const
+        {
+#ifdef FIXED_BASE
+            return f(*mpark::get_if<FIXED_BASE>(&base));
+#else
+            return mpark::visit(std::forward<F>(f), base);
+#endif
+        }
+        template<typename F>
+        KOKKOS_FORCEINLINE_FUNCTION decltype(auto) visit_transform(F&& f) const
+        {
+#ifdef FIXED_TRANSFORM
+            return f(*mpark::get_if<FIXED_TRANSFORM>(&transform));
+#else
+            return mpark::visit(std::forward<F>(f), transform);
+#endif
+        }
+        template<typename T>
+        KOKKOS_FORCEINLINE_FUNCTION bool holds_base() const
+        {
+#ifdef FIXED_BASE
+            return std::is_same<T, FIXED_BASE>::value;
+#else
+            return mpark::holds_alternative<T>(base);
+#endif
+        }
+        template<typename T>
+        KOKKOS_FORCEINLINE_FUNCTION bool holds_transform() const
+        {
+#ifdef FIXED_TRANSFORM
+            return std::is_same<T, FIXED_TRANSFORM>::value;
+#else
+            return mpark::holds_alternative<T>(transform);
+#endif
+        }
 
         // Common code for constructors
 #pragma hd_warning_disable
@@ -206,6 +252,25 @@ class CoordinateEmbedding {
             } else {
                 throw std::invalid_argument("Unsupported base coordinates!");
             }
+
+            // Optionally replace expensive metrics with a table, built once per run.
+            // Points outside the table (e.g. deep inside the horizon) use the analytic metric.
+            // See TabulatedMetric for the error of the default table
+            if (pin->GetOrAddBoolean("coordinates", "tabulate_metric", false)) {
+                const GReal r_out = pin->DoesParameterExist("coordinates", "r_out") ? pin->GetReal("coordinates", "r_out") : 1000.;
+                const GReal rmin = pin->GetOrAddReal("coordinates", "table_rmin", 1.0);
+                const GReal rmax = pin->GetOrAddReal("coordinates", "table_rmax", 1.1*r_out);
+                const int n1 = pin->GetOrAddInteger("coordinates", "table_n1", 512);
+                const int n2 = pin->GetOrAddInteger("coordinates", "table_n2", 256);
+                const GReal tolerance = pin->GetOrAddReal("coordinates", "table_tolerance", 1.e-3);
+                if (holds_base<DCSKSCoords>()) {
+                    table = TabulateMetric(mpark::get<DCSKSCoords>(base), rmin, rmax, n1, n2, tolerance);
+                } else if (holds_base<EDGBKSCoords>()) {
+                    table = TabulateMetric(mpark::get<EDGBKSCoords>(base), rmin, rmax, n1, n2, tolerance);
+                } else {
+                    throw std::invalid_argument("Metric tabulation is only implemented for dCS and EdGB KS coordinates!");
+                }
+            }
 // ___________________________________________________________________________________________________________________
 
             bool spherical = is_spherical();
@@ -255,6 +320,16 @@ class CoordinateEmbedding {
             } else {
                 throw std::invalid_argument("Unsupported coordinate transform!");
             }
+
+            // If we were compiled for just one system, make sure it's this one
+#ifdef FIXED_BASE
+            if (!mpark::holds_alternative<FIXED_BASE>(base))
+                throw std::invalid_argument(std::string("This KHARMA was compiled only for base coordinates ")+FIXED_BASE::name+"!");
+#endif
+#ifdef FIXED_TRANSFORM
+            if (!mpark::holds_alternative<FIXED_TRANSFORM>(transform))
+                throw std::invalid_argument(std::string("This KHARMA was compiled only for coordinate transform ")+FIXED_TRANSFORM::name+"!");
+#endif
         }
 
     // ___________________________________________________________________________________________________________________
@@ -262,7 +337,7 @@ class CoordinateEmbedding {
 #pragma hd_warning_disable
         KOKKOS_FUNCTION CoordinateEmbedding(SomeBaseCoords& base_in, SomeTransform& transform_in): base(base_in), transform(transform_in) {}
 #pragma hd_warning_disable
-        KOKKOS_FUNCTION CoordinateEmbedding(const CoordinateEmbedding& src): base(src.base), transform(src.transform) {}
+        KOKKOS_FUNCTION CoordinateEmbedding(const CoordinateEmbedding& src): base(src.base), transform(src.transform), table(src.table) {}
 #pragma hd_warning_disable
         KOKKOS_FUNCTION const CoordinateEmbedding& operator=(const CoordinateEmbedding& src)
         {
@@ -270,6 +345,7 @@ class CoordinateEmbedding {
             //base.swap(copy.base);
             //transform.swap(copy.transform);
             EmplaceSystems(src.base, src.transform);
+            table = src.table;
             return *this;
         }
         // Convenience functions to get common things:
@@ -278,15 +354,15 @@ class CoordinateEmbedding {
         KOKKOS_INLINE_FUNCTION std::string variant_names() const
         {
             std::string basename(
-                mpark::visit( [&](const auto& self) {
+                visit_base( [&](const auto& self) {
                     return self.name;
-                }, base)
+                })
             );
 
             std::string transformname(
-                mpark::visit( [&](const auto& self) {
+                visit_transform( [&](const auto& self) {
                     return self.name;
-                }, transform)
+                })
             );
 
             return basename + " " + transformname;
@@ -296,35 +372,35 @@ class CoordinateEmbedding {
         // Properties (host or device)
         KOKKOS_INLINE_FUNCTION bool is_spherical() const
         {
-            return mpark::visit( [&](const auto& self) {
+            return visit_base( [&](const auto& self) {
                 return self.spherical;
-            }, base);
+            });
         }
         KOKKOS_INLINE_FUNCTION bool is_transformed() const
         {
-            return !mpark::holds_alternative<NullTransform>(transform);
+            return !holds_transform<NullTransform>();
         }
         KOKKOS_INLINE_FUNCTION GReal get_horizon() const
         {
-            if (mpark::holds_alternative<SphKSCoords>(base) ||
-                mpark::holds_alternative<SphBLCoords>(base) ||
-                mpark::holds_alternative<SphKSExtG>(base) ||
-                mpark::holds_alternative<SphBLExtG>(base)) 
+            if (holds_base<SphKSCoords>() ||
+                holds_base<SphBLCoords>() ||
+                holds_base<SphKSExtG>() ||
+                holds_base<SphBLExtG>()) 
             {
                 const GReal a = get_a();
                 return 1 + m::sqrt(1 - a * a);
             } 
             
-            else if (mpark::holds_alternative<DCSKSCoords>(base) || // Changes Made. 
-                mpark::holds_alternative<DCSBLCoords>(base)) 
+            else if (holds_base<DCSKSCoords>() || // Changes Made. 
+                holds_base<DCSBLCoords>()) 
             {
                 const GReal a = get_a();
                 const GReal zeta = get_zeta();
                 return (1 + sqrt(1 - pow(a,2))) + (-((915*pow(a,2))/28672) - (351479*pow(a,4))/13762560) * zeta ;
             }
 
-            else if (mpark::holds_alternative<EDGBKSCoords>(base) || // Changes Made. 
-                mpark::holds_alternative<EDGBBLCoords>(base))
+            else if (holds_base<EDGBKSCoords>() || // Changes Made. 
+                holds_base<EDGBBLCoords>())
             {
                 const GReal a = get_a();
                 const GReal zeta = get_zeta();
@@ -343,18 +419,18 @@ class CoordinateEmbedding {
 
         KOKKOS_INLINE_FUNCTION GReal get_a() const
         {
-            return mpark::visit( [&](const auto& self) {
+            return visit_base( [&](const auto& self) {
                 return self.a;
-            }, base);
+            });
         }
 
         //Changes made. a get zeta function 
         KOKKOS_INLINE_FUNCTION GReal get_zeta() const
         {
-            if (mpark::holds_alternative<DCSKSCoords>(base)) {
+            if (holds_base<DCSKSCoords>()) {
                 return mpark::get<DCSKSCoords>(base).zeta;
             }
-            else if (mpark::holds_alternative<EDGBKSCoords>(base)) { 
+            else if (holds_base<EDGBKSCoords>()) { 
                 return mpark::get<EDGBKSCoords>(base).zeta;
             }
         }
@@ -363,17 +439,17 @@ class CoordinateEmbedding {
 
         GReal startx(int dir) const
         {
-            return mpark::visit( [&](const auto& self) {
+            return visit_transform( [&](const auto& self) {
                 return self.startx[dir - 1];
-            }, transform);
+            });
         }
     // ___________________________________________________________________________________________________________________
 
         GReal stopx(int dir) const
         {
-            return mpark::visit( [&](const auto& self) {
+            return visit_transform( [&](const auto& self) {
                 return self.stopx[dir - 1];
-            }, transform);
+            });
         }
     // ___________________________________________________________________________________________________________________
 
@@ -384,21 +460,41 @@ class CoordinateEmbedding {
 
         KOKKOS_INLINE_FUNCTION bool is_ks() const
         {
-            return mpark::holds_alternative<SphKSCoords>(base);
+            return holds_base<SphKSCoords>();
         }
         
+        // Whether there is a Boyer-Lindquist form of the base system, see bl_to_native_transform
+        KOKKOS_INLINE_FUNCTION bool has_bl() const
+        {
+            return holds_base<SphKSCoords>() || holds_base<SphBLCoords>() ||
+                   holds_base<SphKSExtG>() || holds_base<SphBLExtG>() ||
+                   holds_base<DCSKSCoords>() || holds_base<DCSBLCoords>() ||
+                   holds_base<EDGBKSCoords>() || holds_base<EDGBBLCoords>();
+        }
+
         KOKKOS_INLINE_FUNCTION bool is_cart_minkowski() const
         {
-            return mpark::holds_alternative<CartMinkowskiCoords>(base) && mpark::holds_alternative<NullTransform>(transform);
+            return holds_base<CartMinkowskiCoords>() && holds_transform<NullTransform>();
+        }
+        // Whether the base system and transform are both templated on their scalar type,
+        // so that conn_native can use exact derivatives.  See dual.hpp
+        KOKKOS_INLINE_FUNCTION bool supports_dual() const
+        {
+            return visit_base( [&](const auto& b) {
+                return visit_transform( [&](const auto& t) {
+                    return dual_base<std::decay_t<decltype(b)>>::value && dual_transform<std::decay_t<decltype(t)>>::value;
+                });
+            });
         }
     // ___________________________________________________________________________________________________________________
 
         // Note this is the one thing we need from BaseCoords
         KOKKOS_INLINE_FUNCTION void gcov_embed(const GReal Xembed[GR_DIM], Real gcov[GR_DIM][GR_DIM]) const
         {
-            mpark::visit( [&Xembed, &gcov](const auto& self) {
+            if (table.enabled() && table.gcov(Xembed, gcov)) return;
+            visit_base( [&Xembed, &gcov](const auto& self) {
                 self.gcov_embed(Xembed, gcov);
-            }, base);
+            });
         }
         // All the quantities we can derive from that
         KOKKOS_INLINE_FUNCTION Real gcon_from_gcov(const Real gcov[GR_DIM][GR_DIM], Real gcon[GR_DIM][GR_DIM]) const
@@ -421,27 +517,27 @@ class CoordinateEmbedding {
         // Now, everything we take from CoordinateTransform
         KOKKOS_INLINE_FUNCTION void coord_to_embed(const GReal Xnative[GR_DIM], GReal Xembed[GR_DIM]) const
         {
-            mpark::visit( [&Xnative, &Xembed](const auto& self) {
+            visit_transform( [&Xnative, &Xembed](const auto& self) {
                 self.coord_to_embed(Xnative, Xembed);
-            }, transform);
+            });
         }
         KOKKOS_INLINE_FUNCTION void coord_to_native(const GReal Xembed[GR_DIM], GReal Xnative[GR_DIM]) const
         {
-            mpark::visit( [&Xnative, &Xembed](const auto& self) {
+            visit_transform( [&Xnative, &Xembed](const auto& self) {
                 self.coord_to_native(Xembed, Xnative);
-            }, transform);
+            });
         }
         KOKKOS_INLINE_FUNCTION void dxdX(const GReal Xnative[GR_DIM], Real dxdX[GR_DIM][GR_DIM]) const
         {
-            mpark::visit( [&Xnative, &dxdX](const auto& self) {
+            visit_transform( [&Xnative, &dxdX](const auto& self) {
                 self.dxdX(Xnative, dxdX);
-            }, transform);
+            });
         }
         KOKKOS_INLINE_FUNCTION void dXdx(const GReal Xnative[GR_DIM], Real dXdx[GR_DIM][GR_DIM]) const
         {
-            mpark::visit( [&Xnative, &dXdx](const auto& self) {
+            visit_transform( [&Xnative, &dXdx](const auto& self) {
                 self.dXdx(Xnative, dXdx);
-            }, transform);
+            });
         }
     // ___________________________________________________________________________________________________________________
 
@@ -450,18 +546,18 @@ class CoordinateEmbedding {
         {
             const GReal Xembed[GR_DIM] = {0., r, 0., 0.};
             GReal Xnative[GR_DIM];
-            mpark::visit( [&Xembed, &Xnative](const auto& self) {
+            visit_transform( [&Xembed, &Xnative](const auto& self) {
                 self.coord_to_native(Xembed, Xnative);
-            }, transform);
+            });
             return Xnative[1];
         }
         KOKKOS_INLINE_FUNCTION GReal X1_to_embed(const GReal X1) const
         {
             const GReal Xnative[GR_DIM] = {0., X1, 0., 0.};
             GReal Xembed[GR_DIM];
-            mpark::visit( [&Xnative, &Xembed](const auto& self) {
+            visit_transform( [&Xnative, &Xembed](const auto& self) {
                 self.coord_to_embed(Xnative, Xembed);
-            }, transform);
+            });
             return Xembed[1];
         }
 
@@ -470,9 +566,9 @@ class CoordinateEmbedding {
         KOKKOS_INLINE_FUNCTION GReal r_of(const GReal Xnative[GR_DIM]) const
         {
             GReal Xembed[GR_DIM];
-            mpark::visit( [&Xnative, &Xembed](const auto& self) {
+            visit_transform( [&Xnative, &Xembed](const auto& self) {
                 self.coord_to_embed(Xnative, Xembed);
-            }, transform);
+            });
             if (is_spherical()) {
                 return Xembed[1];
             } else {
@@ -482,9 +578,9 @@ class CoordinateEmbedding {
         KOKKOS_INLINE_FUNCTION GReal th_of(const GReal Xnative[GR_DIM]) const
         {
             GReal Xembed[GR_DIM];
-            mpark::visit( [&Xnative, &Xembed](const auto& self) {
+            visit_transform( [&Xnative, &Xembed](const auto& self) {
                 self.coord_to_embed(Xnative, Xembed);
-            }, transform);
+            });
             if (is_spherical()) {
                 return Xembed[2];
             } else {
@@ -494,9 +590,9 @@ class CoordinateEmbedding {
         KOKKOS_INLINE_FUNCTION GReal phi_of(const GReal Xnative[GR_DIM]) const
         {
             GReal Xembed[GR_DIM];
-            mpark::visit( [&Xnative, &Xembed](const auto& self) {
+            visit_transform( [&Xnative, &Xembed](const auto& self) {
                 self.coord_to_embed(Xnative, Xembed);
-            }, transform);
+            });
             if (is_spherical()) {
                 return Xembed[3];
             } else {
@@ -506,9 +602,9 @@ class CoordinateEmbedding {
         KOKKOS_INLINE_FUNCTION GReal x_of(const GReal Xnative[GR_DIM]) const
         {
             GReal Xembed[GR_DIM];
-            mpark::visit( [&Xnative, &Xembed](const auto& self) {
+            visit_transform( [&Xnative, &Xembed](const auto& self) {
                 self.coord_to_embed(Xnative, Xembed);
-            }, transform);
+            });
             if (!is_spherical()) {
                 return Xembed[1];
             } else {
@@ -518,9 +614,9 @@ class CoordinateEmbedding {
         KOKKOS_INLINE_FUNCTION GReal y_of(const GReal Xnative[GR_DIM]) const
         {
             GReal Xembed[GR_DIM];
-            mpark::visit( [&Xnative, &Xembed](const auto& self) {
+            visit_transform( [&Xnative, &Xembed](const auto& self) {
                 self.coord_to_embed(Xnative, Xembed);
-            }, transform);
+            });
             if (!is_spherical()) {
                 return Xembed[2];
             } else {
@@ -530,9 +626,9 @@ class CoordinateEmbedding {
         KOKKOS_INLINE_FUNCTION GReal z_of(const GReal Xnative[GR_DIM]) const
         {
             GReal Xembed[GR_DIM];
-            mpark::visit( [&Xnative, &Xembed](const auto& self) {
+            visit_transform( [&Xnative, &Xembed](const auto& self) {
                 self.coord_to_embed(Xnative, Xembed);
-            }, transform);
+            });
             if (!is_spherical()) {
                 return Xembed[3];
             } else {
@@ -636,24 +732,69 @@ class CoordinateEmbedding {
             return gcon_native(X, gcon);
         }
 
-        KOKKOS_INLINE_FUNCTION void conn_native(const GReal X[GR_DIM], const GReal delta, Real conn[GR_DIM][GR_DIM][GR_DIM]) const
+        /**
+         * Derivatives of the native metric, dgcov[lam][kap][nu] = \partial_nu g_{lam kap}, computed exactly
+         * in a single pass with dual numbers.  Returns false without touching dgcov if the
+         * base system or transform is not templated on its scalar type.
+         */
+        KOKKOS_INLINE_FUNCTION bool dgcov_native_dual(const GReal X[GR_DIM], Real dgcov[GR_DIM][GR_DIM][GR_DIM]) const
+        {
+            const TabulatedMetric& tbl = table;
+            return visit_base( [&X, &dgcov, &tbl](const auto& b) {
+                return visit_transform( [&X, &dgcov, &b, &tbl](const auto& t) {
+                    if constexpr (dual_base<std::decay_t<decltype(b)>>::value &&
+                                  dual_transform<std::decay_t<decltype(t)>>::value) {
+                        Dual Xnative[GR_DIM], Xembed[GR_DIM];
+                        for (int mu = 0; mu < GR_DIM; mu++) Xnative[mu] = Dual::variable(X[mu], mu);
+                        t.coord_to_embed(Xnative, Xembed);
+                        Dual gcov_em[GR_DIM][GR_DIM], dxdX_d[GR_DIM][GR_DIM];
+                        if (!(tbl.enabled() && tbl.gcov(Xembed, gcov_em))) b.gcov_embed(Xembed, gcov_em);
+                        t.dxdX(Xnative, dxdX_d);
+                        // As cov_tensor_to_native, carrying derivatives through the transform as well as the metric
+                        for (int lam = 0; lam < GR_DIM; lam++) {
+                            for (int kap = 0; kap < GR_DIM; kap++) {
+                                Dual g(0.);
+                                for (int mu = 0; mu < GR_DIM; mu++)
+                                    for (int nu = 0; nu < GR_DIM; nu++)
+                                        g += gcov_em[mu][nu] * dxdX_d[mu][lam] * dxdX_d[nu][kap];
+                                for (int nu = 0; nu < GR_DIM; nu++) dgcov[lam][kap][nu] = g.d[nu];
+                            }
+                        }
+                        return true;
+                    } else {
+                        return false;
+                    }
+                });
+            });
+        }
+
+        /**
+         * Connection coefficients \Gamma^lam_{nu mu} in native coordinates.
+         * Metric derivatives are taken by central differences with step delta,
+         * or exactly if 'exact' is set and the system supports it (see supports_dual())
+         */
+        KOKKOS_INLINE_FUNCTION void conn_native(const GReal X[GR_DIM], const GReal delta, Real conn[GR_DIM][GR_DIM][GR_DIM],
+                                               const bool exact=false) const
         {
             GReal tmp[GR_DIM][GR_DIM][GR_DIM];
             GReal gcon[GR_DIM][GR_DIM];
-            GReal Xh[GR_DIM], Xl[GR_DIM];
-            GReal gh[GR_DIM][GR_DIM];
-            GReal gl[GR_DIM][GR_DIM];
 
-            for (int nu = 0; nu < GR_DIM; nu++) {
-                DLOOP1 Xl[mu] = X[mu] - delta*(mu == nu);
-                DLOOP1 Xh[mu] = X[mu] + delta*(mu == nu);
-                gcov_native(Xh, gh);
-                gcov_native(Xl, gl);
+            if (!(exact && dgcov_native_dual(X, conn))) {
+                GReal Xh[GR_DIM], Xl[GR_DIM];
+                GReal gh[GR_DIM][GR_DIM];
+                GReal gl[GR_DIM][GR_DIM];
 
-                for (int lam = 0; lam < GR_DIM; lam++) {
-                    for (int kap = 0; kap < GR_DIM; kap++) {
-                        conn[lam][kap][nu] = (gh[lam][kap] - gl[lam][kap])/
-                                                        (Xh[nu] - Xl[nu]);
+                for (int nu = 0; nu < GR_DIM; nu++) {
+                    DLOOP1 Xl[mu] = X[mu] - delta*(mu == nu);
+                    DLOOP1 Xh[mu] = X[mu] + delta*(mu == nu);
+                    gcov_native(Xh, gh);
+                    gcov_native(Xl, gl);
+
+                    for (int lam = 0; lam < GR_DIM; lam++) {
+                        for (int kap = 0; kap < GR_DIM; kap++) {
+                            conn[lam][kap][nu] = (gh[lam][kap] - gl[lam][kap])/
+                                                            (Xh[nu] - Xl[nu]);
+                        }
                     }
                 }
             }
@@ -687,82 +828,101 @@ class CoordinateEmbedding {
     // ___________________________________________________________________________________________________________________
 
         /**
-         * Takes a velocity in Boyer-Lindquist coordinates (optionally without time component) and converts it
-         * to KS, and then to native coordinates.
-         * Not guaranteed to be fast.
+         * Boyer-Lindquist metric at Xnative, and the matrix taking BL contravariant vectors to native coordinates
+         * (through KS, if we're using KS base coords).  These are everything bl_fourvel_to_native needs,
+         * and are cached at zone centers by GRCoordinates
          */
-        KOKKOS_INLINE_FUNCTION void bl_fourvel_to_native(const Real Xnative[GR_DIM], const Real ucon_bl[GR_DIM], Real ucon_native[GR_DIM]) const
+        KOKKOS_INLINE_FUNCTION void bl_to_native_transform(const GReal Xnative[GR_DIM], GReal gcov_bl[GR_DIM][GR_DIM], GReal trans[GR_DIM][GR_DIM]) const
         {
             GReal Xembed[GR_DIM];
             coord_to_embed(Xnative, Xembed);
 
-            // Set u^t to make u a velocity 4-vector in BL
-            GReal gcov_bl[GR_DIM][GR_DIM];
-
-            // // TRYING 
-
-            if (mpark::holds_alternative<SphKSCoords>(base) ||
-                mpark::holds_alternative<SphBLCoords>(base)) {
+            if (holds_base<SphKSCoords>() ||
+                holds_base<SphBLCoords>()) {
                 SphBLCoords(get_a()).gcov_embed(Xembed, gcov_bl);
 
-            } else if (mpark::holds_alternative<SphKSExtG>(base) ||
-                       mpark::holds_alternative<SphBLExtG>(base)) {
+            } else if (holds_base<SphKSExtG>() ||
+                       holds_base<SphBLExtG>()) {
                 SphBLExtG(get_a()).gcov_embed(Xembed, gcov_bl);
 
-            } else if (mpark::holds_alternative<DCSKSCoords>(base)){
+            } else if (holds_base<DCSKSCoords>()){
                 GReal zeta = mpark::get<DCSKSCoords>(base).zeta;
                 DCSBLCoords dcsblcoords(get_a(), zeta);
                 dcsblcoords.gcov_embed(Xembed, gcov_bl);       // Changes Made. Find out how the zeta value gets called.
         
-            } else if (mpark::holds_alternative<DCSBLCoords>(base)){
+            } else if (holds_base<DCSBLCoords>()){
                 GReal zeta = mpark::get<DCSBLCoords>(base).zeta;
                 DCSBLCoords(get_a(), zeta).gcov_embed(Xembed, gcov_bl);       // Changes Made. Find out how the zeta value gets called.
                 
-            } else if (mpark::holds_alternative<EDGBKSCoords>(base)){
+            } else if (holds_base<EDGBKSCoords>()){
                 GReal zeta = mpark::get<EDGBKSCoords>(base).zeta;
                 EDGBBLCoords edgbblcoords(get_a(), zeta);
                 edgbblcoords.gcov_embed(Xembed, gcov_bl);       // Changes Made. Find out how the zeta value gets called.
         
-            } else if (mpark::holds_alternative<EDGBBLCoords>(base)){
+            } else if (holds_base<EDGBBLCoords>()){
                 GReal zeta = mpark::get<EDGBBLCoords>(base).zeta;
                 EDGBBLCoords(get_a(), zeta).gcov_embed(Xembed, gcov_bl);   
             }
-    
 
+            // BL to base coordinates.  Each column is the image of a BL unit vector
+            GReal to_base[GR_DIM][GR_DIM];
+            for (int nu = 0; nu < GR_DIM; ++nu) {
+                Real e_bl[GR_DIM] = {0., 0., 0., 0.};
+                e_bl[nu] = 1.;
+                Real e_base[GR_DIM];
+                if (holds_base<SphKSCoords>()) {
+                    mpark::get<SphKSCoords>(base).vec_from_bl(Xembed, e_bl, e_base);
+                } else if (holds_base<SphKSExtG>()) {
+                    mpark::get<SphKSExtG>(base).vec_from_bl(Xembed, e_bl, e_base);
+                } else if (holds_base<DCSKSCoords>()) {
+                    mpark::get<DCSKSCoords>(base).vec_from_bl(Xembed, e_bl, e_base);
+                } else if (holds_base<EDGBKSCoords>()) {
+                    mpark::get<EDGBKSCoords>(base).vec_from_bl(Xembed, e_bl, e_base);
+                } else if (holds_base<SphBLCoords>() || holds_base<SphBLExtG>() ||
+                           holds_base<DCSBLCoords>() || holds_base<EDGBBLCoords>()) {
+                    for (int mu = 0; mu < GR_DIM; ++mu) e_base[mu] = e_bl[mu];
+                } else {
+                    #ifndef KOKKOS_ENABLE_CUDA
+                    throw std::invalid_argument("Unsupported base coordinates!");
+                    #endif
+                }
+                for (int mu = 0; mu < GR_DIM; ++mu) to_base[mu][nu] = e_base[mu];
+            }
+
+            // Then apply any transform to native coordinates
+            Real dXdx_temp[GR_DIM][GR_DIM];
+            dXdx(Xnative, dXdx_temp);
+            DLOOP2 {
+                trans[mu][nu] = 0.;
+                for (int lam = 0; lam < GR_DIM; ++lam) trans[mu][nu] += dXdx_temp[mu][lam] * to_base[lam][nu];
+            }
+        }
+
+        /**
+         * Takes a velocity in Boyer-Lindquist coordinates (optionally without time component) and converts it
+         * to KS, and then to native coordinates, given the output of bl_to_native_transform.
+         */
+        KOKKOS_INLINE_FUNCTION static void bl_fourvel_to_native(const GReal gcov_bl[GR_DIM][GR_DIM], const GReal trans[GR_DIM][GR_DIM],
+                                                                const Real ucon_bl[GR_DIM], Real ucon_native[GR_DIM])
+        {
+            // Set u^t to make u a velocity 4-vector in BL
             Real ucon_bl_fourv[GR_DIM];
             DLOOP1 ucon_bl_fourv[mu] = ucon_bl[mu];
             set_ut(gcov_bl, ucon_bl_fourv);
 
-            // Then transform that 4-vector to KS (or not, if we're using BL base coords)
-            Real ucon_base[GR_DIM];
-            if (mpark::holds_alternative<SphKSCoords>(base)) {
-                mpark::get<SphKSCoords>(base).vec_from_bl(Xembed, ucon_bl_fourv, ucon_base);
-
-            } else if (mpark::holds_alternative<SphKSExtG>(base)) {
-                mpark::get<SphKSExtG>(base).vec_from_bl(Xembed, ucon_bl_fourv, ucon_base);
-
-            } else if (mpark::holds_alternative<SphBLCoords>(base) ||
-                       mpark::holds_alternative<SphBLExtG>(base)) {
-                DLOOP1 ucon_base[mu] = ucon_bl_fourv[mu];
-
-            } else if (mpark::holds_alternative<DCSKSCoords>(base)) {                           // Changes Made.
-                mpark::get<DCSKSCoords>(base).vec_from_bl(Xembed, ucon_bl_fourv, ucon_base); 
-
-            } else if (mpark::holds_alternative<EDGBKSCoords>(base)) {                          // Changes Made.
-                mpark::get<EDGBKSCoords>(base).vec_from_bl(Xembed, ucon_bl_fourv, ucon_base); 
-
-            } else if (mpark::holds_alternative<DCSBLCoords>(base)) {
-                DLOOP1 ucon_base[mu] = ucon_bl_fourv[mu];
-            } else if (mpark::holds_alternative<EDGBBLCoords>(base)) {
-                DLOOP1 ucon_base[mu] = ucon_bl_fourv[mu];
-
-            } else {
-                #ifndef KOKKOS_ENABLE_CUDA
-                throw std::invalid_argument("Unsupported base coordinates!");
-                #endif
+            DLOOP1 {
+                ucon_native[mu] = 0.;
+                for (int nu = 0; nu < GR_DIM; ++nu) ucon_native[mu] += trans[mu][nu] * ucon_bl_fourv[nu];
             }
-            // Finally, apply any transform to native coordinates
-            con_vec_to_native(Xnative, ucon_base, ucon_native);
+        }
+        /**
+         * As above, at any point.  Not guaranteed to be fast: prefer GRCoordinates::bl_fourvel_to_native at zone centers
+         */
+        KOKKOS_INLINE_FUNCTION void bl_fourvel_to_native(const Real Xnative[GR_DIM], const Real ucon_bl[GR_DIM], Real ucon_native[GR_DIM]) const
+        {
+            GReal gcov_bl[GR_DIM][GR_DIM], trans[GR_DIM][GR_DIM];
+            bl_to_native_transform(Xnative, gcov_bl, trans);
+            bl_fourvel_to_native(gcov_bl, trans, ucon_bl, ucon_native);
         }
 };
 
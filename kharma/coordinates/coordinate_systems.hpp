@@ -40,6 +40,7 @@
 
 #include "decs.hpp"
 
+#include "dual.hpp"
 #include "matrix.hpp"
 #include "kharma_utils.hpp"
 #include "root_find.hpp"
@@ -80,7 +81,8 @@ class CartMinkowskiCoords {
         static constexpr char name[] = "CartMinkowskiCoords";
         static constexpr bool spherical = false;
         static constexpr GReal a = 0.0;
-        KOKKOS_INLINE_FUNCTION void gcov_embed(const GReal Xembed[GR_DIM], Real gcov[GR_DIM][GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void gcov_embed(const T Xembed[GR_DIM], T gcov[GR_DIM][GR_DIM]) const
         {
             DLOOP2 gcov[mu][nu] = (mu == nu) - 2*(mu == 0 && nu == 0);
         }
@@ -95,11 +97,13 @@ class SphMinkowskiCoords {
         static constexpr char name[] = "SphMinkowskiCoords";
         static constexpr bool spherical = true;
         static constexpr GReal a = 0.0;
-        KOKKOS_INLINE_FUNCTION void gcov_embed(const GReal Xembed[GR_DIM], Real gcov[GR_DIM][GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void gcov_embed(const T Xembed[GR_DIM], T gcov[GR_DIM][GR_DIM]) const
         {
-            const GReal r = m::max(Xembed[1], SMALL);
-            const GReal th = excise(excise(Xembed[2], 0.0, SMALL), M_PI, SMALL);
-            const GReal sth = m::sin(th);
+            using m::max; using m::sin;
+            const T r = max(Xembed[1], SMALL);
+            const T th = excise(excise(Xembed[2], 0.0, SMALL), M_PI, SMALL);
+            const T sth = sin(th);
 
             gzero2(gcov);
             gcov[0][0] = 1.;
@@ -122,15 +126,17 @@ class SphKSCoords {
 
         KOKKOS_FUNCTION SphKSCoords(GReal spin): a(spin) {};
 
-        KOKKOS_INLINE_FUNCTION void gcov_embed(const GReal Xembed[GR_DIM], Real gcov[GR_DIM][GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void gcov_embed(const T Xembed[GR_DIM], T gcov[GR_DIM][GR_DIM]) const
         {
-            const GReal r = Xembed[1];
-            const GReal th = excise(excise(Xembed[2], 0.0, SMALL), M_PI, SMALL);
+            using m::cos; using m::sin;
+            const T r = Xembed[1];
+            const T th = excise(excise(Xembed[2], 0.0, SMALL), M_PI, SMALL);
 
-            const GReal cth = m::cos(th);
-            const GReal sth = m::sin(th);
-            const GReal sin2 = sth*sth;
-            const GReal rho2 = r*r + a*a*cth*cth;
+            const T cth = cos(th);
+            const T sth = sin(th);
+            const T sin2 = sth*sth;
+            const T rho2 = r*r + a*a*cth*cth;
 
             gcov[0][0] = -1. + 2.*r/rho2;
             gcov[0][1] = 2.*r/rho2;
@@ -168,16 +174,10 @@ class SphKSCoords {
 
         KOKKOS_INLINE_FUNCTION void vec_to_bl(const GReal Xembed[GR_DIM], const Real vcon_bl[GR_DIM], Real vcon[GR_DIM]) const
         {
-            GReal r = Xembed[1];
-            GReal rtrans[GR_DIM][GR_DIM], trans[GR_DIM][GR_DIM];
-            DLOOP2 rtrans[mu][nu] = (mu == nu);
-            rtrans[0][1] = 2.*r/(r*r - 2.*r + a*a);
-            rtrans[3][1] = a/(r*r - 2.*r + a*a);
-
-            invert(&rtrans[0][0], &trans[0][0]);
-
-            gzero(vcon);
-            DLOOP2 vcon[mu] += trans[mu][nu]*vcon_bl[nu];
+            // The transformation from BL is I + N, with N nonzero only in column 1.  So N^2 = 0, and the inverse is I - N
+            Real vcon_tmp[GR_DIM];
+            vec_from_bl(Xembed, vcon_bl, vcon_tmp);
+            DLOOP1 vcon[mu] = 2.*vcon_bl[mu] - vcon_tmp[mu];
         }
 };
 // ____________________________________________________________________________________________________________________________
@@ -253,19 +253,10 @@ class SphKSExtG {
 
         KOKKOS_INLINE_FUNCTION void vec_to_bl(const GReal Xembed[GR_DIM], const Real vcon_bl[GR_DIM], Real vcon[GR_DIM]) const
         {
-            GReal r = Xembed[1];
-            GReal rtrans[GR_DIM][GR_DIM], trans[GR_DIM][GR_DIM];
-            DLOOP2 rtrans[mu][nu] = (mu == nu);
-
-            const GReal Phi_g = (A / (B-1.)) * (m::pow(r, B-1.) - m::pow(2, B-1.));
-
-            rtrans[0][1] = (2./r - 2.*Phi_g)/(1. - 2./r + 2.*Phi_g);
-            rtrans[3][1] = a/(r*r - 2.*r + a*a);
-
-            invert(&rtrans[0][0], &trans[0][0]);
-
-            gzero(vcon);
-            DLOOP2 vcon[mu] += trans[mu][nu]*vcon_bl[nu];
+            // The transformation from BL is I + N, with N nonzero only in column 1.  So N^2 = 0, and the inverse is I - N
+            Real vcon_tmp[GR_DIM];
+            vec_from_bl(Xembed, vcon_bl, vcon_tmp);
+            DLOOP1 vcon[mu] = 2.*vcon_bl[mu] - vcon_tmp[mu];
         }
 };
 
@@ -361,18 +352,20 @@ class DCSKSCoords {
 
         KOKKOS_FUNCTION DCSKSCoords(GReal spin, GReal z): a(spin), zeta(z) {} //semicolon here ?
 
-        KOKKOS_INLINE_FUNCTION void gcov_embed(const GReal Xembed[GR_DIM], Real gcov[GR_DIM][GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void gcov_embed(const T Xembed[GR_DIM], T gcov[GR_DIM][GR_DIM]) const
         {
-            const GReal r = Xembed[1];
-            const GReal th = excise(excise(Xembed[2], 0.0, SMALL), M_PI, SMALL);
+            using m::cos; using m::sin;
+            const T r = Xembed[1];
+            const T th = excise(excise(Xembed[2], 0.0, SMALL), M_PI, SMALL);
             
             // Assign gcov matrix to zero. 
 
-            const GReal cth = m::cos(th);
-            const GReal sth = m::sin(th);
-            const GReal s2t = sth*sth;
-            const GReal c2t = cth*cth ; 
-            const GReal c4t = c2t*c2t ;
+            const T cth = cos(th);
+            const T sth = sin(th);
+            const T s2t = sth*sth;
+            const T c2t = cth*cth ; 
+            const T c4t = c2t*c2t ;
             // const GReal rho2 = r*r + a*a*cth*cth;
             const GReal ep2 = a*a ;
             const GReal ep3 = a * ep2 ;
@@ -617,50 +610,10 @@ class DCSKSCoords {
 
         KOKKOS_INLINE_FUNCTION void vec_to_bl(const GReal Xembed[GR_DIM], const Real vcon_bl[GR_DIM], Real vcon[GR_DIM]) const
         {
-            GReal r = Xembed[1];
-            const GReal th = excise(excise(Xembed[2], 0.0, SMALL), M_PI, SMALL);
-            GReal rtrans[GR_DIM][GR_DIM], trans[GR_DIM][GR_DIM];
-            DLOOP2 rtrans[mu][nu] = (mu == nu);
-
-            const GReal cth = m::cos(th);
-            const GReal sth = m::sin(th);
-            const GReal s2t = sth*sth;
-            const GReal c2t = cth*cth ; 
-            const GReal c4t = c2t*c2t ;
-            const GReal ep2 = a*a ;
-            const GReal ep4 = ep2*ep2 ;
-
-            trans[0][0] = 1;
-            trans[0][1] = -1.+ (pow(r,2.)+ ep2)/((-1.+ r - sqrt(1.- ep2) - 
-        ((-915.*ep2)/28672.- (351479.*ep4)/13762560.)*zeta)*
-       (-1.+ r + sqrt(1.- ep2) + ((477.*ep2)/4096.+ 
-          (731081.*ep4)/13762560.)*zeta)) ;
-            trans[0][2] = 0;
-            trans[0][3] = 0;
-
-            trans[1][0] = 0 ;
-            trans[1][1] = 1 ;
-            trans[1][2] = 0 ;
-            trans[1][3] = 0 ;
-
-            trans[2][0] = 0 ;
-            trans[2][1] = 0 ;
-            trans[2][2] = 1 ;
-            trans[2][3] = 0 ;
-
-            trans[3][0] = 0;
-            trans[3][1] = a/((-1.+ r - sqrt(1.- ep2) - 
-       ((-915.*ep2)/28672.- (351479.*ep4)/13762560.)*zeta)*
-      (-1.+ r + sqrt(1.- ep2) + 
-       (709/3584.+ (7477.*ep2)/86016.+ (10982957.*ep4)/
-          151388160.)*zeta));
-            trans[3][2] = 0;
-            trans[3][3] = 1;
-
-            invert(&rtrans[0][0], &trans[0][0]); // INVERTING BECAUSE IT IS NOW FROM KS TO BL!!! 
-
-            gzero(vcon);
-            DLOOP2 vcon[mu] += trans[mu][nu]*vcon_bl[nu];
+            // The transformation from BL is I + N, with N nonzero only in column 1.  So N^2 = 0, and the inverse is I - N
+            Real vcon_tmp[GR_DIM];
+            vec_from_bl(Xembed, vcon_bl, vcon_tmp);
+            DLOOP1 vcon[mu] = 2.*vcon_bl[mu] - vcon_tmp[mu];
         }
 };
 
@@ -847,20 +800,22 @@ class EDGBKSCoords {
 
         KOKKOS_FUNCTION EDGBKSCoords(GReal spin, GReal z): a(spin), zeta(z) {}
 
-        KOKKOS_INLINE_FUNCTION void gcov_embed(const GReal Xembed[GR_DIM], Real gcov[GR_DIM][GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void gcov_embed(const T Xembed[GR_DIM], T gcov[GR_DIM][GR_DIM]) const
         {
-            const GReal r = Xembed[1];
-            const GReal th = excise(excise(Xembed[2], 0.0, SMALL), M_PI, SMALL);
+            using m::cos; using m::sin;
+            const T r = Xembed[1];
+            const T th = excise(excise(Xembed[2], 0.0, SMALL), M_PI, SMALL);
             
             // Assign gcov matrix to zero.
             gzero2(gcov); 
 
-            const GReal cth = m::cos(th);
-            const GReal sth = m::sin(th);
-            const GReal s2 = sth*sth;
-            const GReal c2t = cth*cth; 
-            const GReal c4t = c2t*c2t;
-            const GReal rho2 = r*r + a*a*cth*cth;
+            const T cth = cos(th);
+            const T sth = sin(th);
+            const T s2 = sth*sth;
+            const T c2t = cth*cth; 
+            const T c4t = c2t*c2t;
+            const T rho2 = r*r + a*a*cth*cth;
             const GReal a2 = a*a;
             const GReal ep2 = a2;
             const GReal ep3 = a * ep2 ;
@@ -1135,52 +1090,10 @@ class EDGBKSCoords {
 
         KOKKOS_INLINE_FUNCTION void vec_to_bl(const GReal Xembed[GR_DIM], const Real vcon_bl[GR_DIM], Real vcon[GR_DIM]) const
         {
-            GReal r = Xembed[1];
-            const GReal th = excise(excise(Xembed[2], 0.0, SMALL), M_PI, SMALL);
-            GReal rtrans[GR_DIM][GR_DIM], trans[GR_DIM][GR_DIM];
-            DLOOP2 rtrans[mu][nu] = (mu == nu);
-
-            const GReal cth = m::cos(th);
-            const GReal sth = m::sin(th);
-            const GReal s2t = sth*sth;
-            const GReal c2t = cth*cth ; 
-            const GReal c4t = c2t*c2t ;
-            const GReal ep2 = a*a ;
-            const GReal ep3 = a * ep2 ;
-            const GReal ep4 = ep2*ep2 ;
-
-            trans[0][0] = 1;  
-            trans[0][1] = -1.+ (pow(r,2.)+ ep2)/((-1.+ r - sqrt(1.- ep2) - 
-        (-49/40.- (277.*ep2)/960.- (145711.*ep4)/3225600.)*
-         zeta)*(-1.+ r + sqrt(1.- ep2) + 
-        (-1/120.- (613.*ep2)/960.+ (2792449.*ep4)/3225600.)*
-         zeta));
-            trans[0][2] = 0;
-            trans[0][3] = 0;
-
-            trans[1][0] = 0;
-            trans[1][1] = 1; 
-            trans[1][2] = 0;
-            trans[1][3] = 0;
-
-            trans[2][0] = 0 ;
-            trans[2][1] = 0 ; 
-            trans[2][2] = 1 ;
-            trans[2][3] = 0 ;
-
-            trans[3][0] = 0 ;
-            trans[3][1] = a/((-1.+ r - sqrt(1.- ep2) - 
-       (-49/40.- (277.*ep2)/960.- (145711.*ep4)/3225600.)*
-        zeta)*(-1.+ r + sqrt(1.- ep2) + 
-       (41/120.+ (113497.*ep2)/100800.+ (38608501.*ep4)/
-          35481600.)*zeta)) ; 
-            trans[3][2] = 0 ; 
-            trans[3][3] = 1 ;
-
-            invert(&rtrans[0][0], &trans[0][0]); // INVERTING BECAUSE IT IS NOW FROM KS TO BL!!! 
-
-            gzero(vcon);
-            DLOOP2 vcon[mu] += trans[mu][nu]*vcon_bl[nu];
+            // The transformation from BL is I + N, with N nonzero only in column 1.  So N^2 = 0, and the inverse is I - N
+            Real vcon_tmp[GR_DIM];
+            vec_from_bl(Xembed, vcon_bl, vcon_tmp);
+            DLOOP1 vcon[mu] = 2.*vcon_bl[mu] - vcon_tmp[mu];
         }
 };
 
@@ -1397,7 +1310,8 @@ class NullTransform {
         static constexpr GReal stopx[3] = {-1, -1, -1};
         // Coordinate transformations
         // Any coordinate value protections (th < 0, th > pi, phi > 2pi) should be in the base system
-        KOKKOS_INLINE_FUNCTION void coord_to_embed(const GReal Xnative[GR_DIM], GReal Xembed[GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void coord_to_embed(const T Xnative[GR_DIM], T Xembed[GR_DIM]) const
         {
             DLOOP1 Xembed[mu] = Xnative[mu];
         }
@@ -1406,7 +1320,8 @@ class NullTransform {
             DLOOP1 Xnative[mu] = Xembed[mu];
         }
         // Tangent space transformation matrices
-        KOKKOS_INLINE_FUNCTION void dxdX(const GReal X[GR_DIM], Real dxdX[GR_DIM][GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void dxdX(const T X[GR_DIM], T dxdX[GR_DIM][GR_DIM]) const
         {
             DLOOP2 dxdX[mu][nu] = (mu == nu);
         }
@@ -1423,7 +1338,8 @@ class SphNullTransform {
         static constexpr GReal stopx[3] = {-1, M_PI, 2*M_PI};
         // Coordinate transformations
         // Any coordinate value protections (th < 0, th > pi, phi > 2pi) should be in the base system
-        KOKKOS_INLINE_FUNCTION void coord_to_embed(const GReal Xnative[GR_DIM], GReal Xembed[GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void coord_to_embed(const T Xnative[GR_DIM], T Xembed[GR_DIM]) const
         {
             DLOOP1 Xembed[mu] = Xnative[mu];
         }
@@ -1432,7 +1348,8 @@ class SphNullTransform {
             DLOOP1 Xnative[mu] = Xembed[mu];
         }
         // Tangent space transformation matrices
-        KOKKOS_INLINE_FUNCTION void dxdX(const GReal X[GR_DIM], Real dxdX[GR_DIM][GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void dxdX(const T X[GR_DIM], T dxdX[GR_DIM][GR_DIM]) const
         {
             DLOOP2 dxdX[mu][nu] = (mu == nu);
         }
@@ -1453,10 +1370,12 @@ class ExponentialTransform {
         static constexpr GReal stopx[3] = {-1, M_PI, 2*M_PI};
 
         // Coordinate transformations
-        KOKKOS_INLINE_FUNCTION void coord_to_embed(const GReal Xnative[GR_DIM], GReal Xembed[GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void coord_to_embed(const T Xnative[GR_DIM], T Xembed[GR_DIM]) const
         {
+            using m::exp;
             Xembed[0] = Xnative[0];
-            Xembed[1] = m::exp(Xnative[1]);
+            Xembed[1] = exp(Xnative[1]);
 #if LEGACY_TH
             Xembed[2] = excise(excise(Xnative[2], 0.0, SMALL), M_PI, SMALL);
 #else
@@ -1474,11 +1393,13 @@ class ExponentialTransform {
         /**
          * Transformation matrix for contravariant vectors to embedding, or covariant vectors to native
          */
-        KOKKOS_INLINE_FUNCTION void dxdX(const GReal Xnative[GR_DIM], Real dxdX[GR_DIM][GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void dxdX(const T Xnative[GR_DIM], T dxdX[GR_DIM][GR_DIM]) const
         {
+            using m::exp;
             gzero2(dxdX);
             dxdX[0][0] = 1.;
-            dxdX[1][1] = m::exp(Xnative[1]);
+            dxdX[1][1] = exp(Xnative[1]);
             dxdX[2][2] = 1.;
             dxdX[3][3] = 1.;
         }
@@ -1530,8 +1451,21 @@ class SuperExponentialTransform {
             Xnative[0] = Xembed[0];
             Xnative[2] = Xembed[2];
             Xnative[3] = Xembed[3];
-            // TODO can just take log for x1 < xe1br
-            ROOT_FIND_1
+            const GReal logr = m::log(Xembed[1]);
+            if (logr <= xn1br) {
+                Xnative[1] = logr;
+            } else {
+                // log(r) = X1 + cpow2 (X1 - xn1br)^npow2 is increasing & convex here, so Newton's method
+                // converges monotonically down from X1 = log(r)
+                GReal X1 = logr;
+                for (int iter = 0; iter < ROOTFIND_MAX_ITER; iter++) {
+                    const GReal super_dist = X1 - xn1br;
+                    const GReal err = X1 + cpow2 * m::pow(super_dist, npow2) - logr;
+                    if (m::abs(err) < ROOTFIND_TOL) break;
+                    X1 = m::max(X1 - err / (1 + cpow2 * npow2 * m::pow(super_dist, npow2-1)), xn1br);
+                }
+                Xnative[1] = X1;
+            }
         }
         /**
          * Transformation matrix for contravariant vectors to embedding, or covariant vectors to native
@@ -1577,15 +1511,17 @@ class ModifyTransform {
         KOKKOS_FUNCTION ModifyTransform(GReal hslope_in): hslope(hslope_in) {}
 
         // Coordinate transformations
-        KOKKOS_INLINE_FUNCTION void coord_to_embed(const GReal Xnative[GR_DIM], GReal Xembed[GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void coord_to_embed(const T Xnative[GR_DIM], T Xembed[GR_DIM]) const
         {
+            using m::exp; using m::sin;
             Xembed[0] = Xnative[0];
-            Xembed[1] = m::exp(Xnative[1]);
+            Xembed[1] = exp(Xnative[1]);
 #if LEGACY_TH
-            const GReal th = M_PI*Xnative[2] + ((1. - hslope)/2.)*m::sin(2.*M_PI*Xnative[2]);
+            const T th = M_PI*Xnative[2] + ((1. - hslope)/2.)*sin(2.*M_PI*Xnative[2]);
             Xembed[2] = excise(excise(th, 0.0, SMALL), M_PI, SMALL);
 #else
-            Xembed[2] = M_PI*Xnative[2] + ((1. - hslope)/2.)*m::sin(2.*M_PI*Xnative[2]);
+            Xembed[2] = M_PI*Xnative[2] + ((1. - hslope)/2.)*sin(2.*M_PI*Xnative[2]);
 #endif
             Xembed[3] = Xnative[3];
         }
@@ -1594,18 +1530,20 @@ class ModifyTransform {
             Xnative[0] = Xembed[0];
             Xnative[1] = m::log(Xembed[1]);
             Xnative[3] = Xembed[3];
-            // Treat the special case with a large macro
-            ROOT_FIND
+            // No closed form for X2(th)
+            Xnative[2] = root_find_x2(*this, Xembed, Xnative);
         }
         /**
          * Transformation matrix for contravariant vectors to embedding, or covariant vectors to native
          */
-        KOKKOS_INLINE_FUNCTION void dxdX(const GReal Xnative[GR_DIM], Real dxdX[GR_DIM][GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void dxdX(const T Xnative[GR_DIM], T dxdX[GR_DIM][GR_DIM]) const
         {
+            using m::exp; using m::cos;
             gzero2(dxdX);
             dxdX[0][0] = 1.;
-            dxdX[1][1] = m::exp(Xnative[1]);
-            dxdX[2][2] = M_PI - (hslope - 1.)*M_PI*m::cos(2.*M_PI*Xnative[2]);
+            dxdX[1][1] = exp(Xnative[1]);
+            dxdX[2][2] = M_PI - (hslope - 1.)*M_PI*cos(2.*M_PI*Xnative[2]);
             dxdX[3][3] = 1.;
         }
         /**
@@ -1642,19 +1580,21 @@ class FunkyTransform {
             poly_norm(0.5 * M_PI * 1./(1. + 1./(poly_alpha + 1.) * 1./m::pow(poly_xt, poly_alpha))) {}
 
         // Coordinate transformations
-        KOKKOS_INLINE_FUNCTION void coord_to_embed(const GReal Xnative[GR_DIM], GReal Xembed[GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void coord_to_embed(const T Xnative[GR_DIM], T Xembed[GR_DIM]) const
         {
+            using m::exp; using m::sin; using m::pow;
             Xembed[0] = Xnative[0];
-            Xembed[1] = m::exp(Xnative[1]);
+            Xembed[1] = exp(Xnative[1]);
 
-            const GReal thG = M_PI*Xnative[2] + ((1. - hslope)/2.)*m::sin(2.*M_PI*Xnative[2]);
-            const GReal y = 2*Xnative[2] - 1.;
-            const GReal thJ = poly_norm * y * (1. + m::pow(y/poly_xt,poly_alpha) / (poly_alpha + 1.)) + 0.5 * M_PI;
+            const T thG = M_PI*Xnative[2] + ((1. - hslope)/2.)*sin(2.*M_PI*Xnative[2]);
+            const T y = 2*Xnative[2] - 1.;
+            const T thJ = poly_norm * y * (1. + pow(y/poly_xt,poly_alpha) / (poly_alpha + 1.)) + 0.5 * M_PI;
 #if LEGACY_TH
-            const GReal th = thG + m::exp(mks_smooth * (startx1 - Xnative[1])) * (thJ - thG);
+            const T th = thG + exp(mks_smooth * (startx1 - Xnative[1])) * (thJ - thG);
             Xembed[2] = excise(excise(th, 0.0, SMALL), M_PI, SMALL);
 #else
-            Xembed[2] = thG + m::exp(mks_smooth * (startx1 - Xnative[1])) * (thJ - thG);
+            Xembed[2] = thG + exp(mks_smooth * (startx1 - Xnative[1])) * (thJ - thG);
 #endif
             Xembed[3] = Xnative[3];
         }
@@ -1663,37 +1603,39 @@ class FunkyTransform {
             Xnative[0] = Xembed[0];
             Xnative[1] = m::log(Xembed[1]);
             Xnative[3] = Xembed[3];
-            // Treat the special case with a macro
-            ROOT_FIND
+            // No closed form for X2(th)
+            Xnative[2] = root_find_x2(*this, Xembed, Xnative);
         }
         /**
          * Transformation matrix for contravariant vectors to embedding, or covariant vectors to native
          */
-        KOKKOS_INLINE_FUNCTION void dxdX(const GReal Xnative[GR_DIM], Real dxdX[GR_DIM][GR_DIM]) const
+        template<typename T>
+        KOKKOS_INLINE_FUNCTION void dxdX(const T Xnative[GR_DIM], T dxdX[GR_DIM][GR_DIM]) const
         {
+            using m::exp; using m::sin; using m::cos; using m::pow;
             gzero2(dxdX);
             dxdX[0][0] = 1.;
-            dxdX[1][1] = m::exp(Xnative[1]);
+            dxdX[1][1] = exp(Xnative[1]);
             dxdX[2][1] = -exp(mks_smooth * (startx1 - Xnative[1])) * mks_smooth
                 * (
                 M_PI / 2. -
                 M_PI * Xnative[2]
                     + poly_norm * (2. * Xnative[2] - 1.)
                         * (1
-                            + (m::pow((-1. + 2 * Xnative[2]) / poly_xt, poly_alpha))
+                            + (pow((-1. + 2 * Xnative[2]) / poly_xt, poly_alpha))
                                 / (1 + poly_alpha))
-                    - 1. / 2. * (1. - hslope) * m::sin(2. * M_PI * Xnative[2]));
-            dxdX[2][2] = M_PI + (1. - hslope) * M_PI * m::cos(2. * M_PI * Xnative[2])
-                + m::exp(mks_smooth * (startx1 - Xnative[1]))
+                    - 1. / 2. * (1. - hslope) * sin(2. * M_PI * Xnative[2]));
+            dxdX[2][2] = M_PI + (1. - hslope) * M_PI * cos(2. * M_PI * Xnative[2])
+                + exp(mks_smooth * (startx1 - Xnative[1]))
                     * (-M_PI
                         + 2. * poly_norm
                             * (1.
-                                + m::pow((2. * Xnative[2] - 1.) / poly_xt, poly_alpha)
+                                + pow((2. * Xnative[2] - 1.) / poly_xt, poly_alpha)
                                     / (poly_alpha + 1.))
                         + (2. * poly_alpha * poly_norm * (2. * Xnative[2] - 1.)
-                            * m::pow((2. * Xnative[2] - 1.) / poly_xt, poly_alpha - 1.))
+                            * pow((2. * Xnative[2] - 1.) / poly_xt, poly_alpha - 1.))
                             / ((1. + poly_alpha) * poly_xt)
-                        - (1. - hslope) * M_PI * m::cos(2. * M_PI * Xnative[2]));
+                        - (1. - hslope) * M_PI * cos(2. * M_PI * Xnative[2]));
             dxdX[3][3] = 1.;
         }
         /**
@@ -1701,10 +1643,15 @@ class FunkyTransform {
          */
         KOKKOS_INLINE_FUNCTION void dXdx(const GReal Xnative[GR_DIM], Real dXdx[GR_DIM][GR_DIM]) const
         {
-            // Okay this one should probably stay numerical
+            // dxdX is lower-triangular in (X1, X2), so invert the 2x2 block directly
             Real dxdX_tmp[GR_DIM][GR_DIM];
             dxdX(Xnative, dxdX_tmp);
-            invert(&dxdX_tmp[0][0],&dXdx[0][0]);
+            gzero2(dXdx);
+            dXdx[0][0] = 1.;
+            dXdx[1][1] = 1. / dxdX_tmp[1][1];
+            dXdx[2][1] = -dxdX_tmp[2][1] / (dxdX_tmp[1][1] * dxdX_tmp[2][2]);
+            dXdx[2][2] = 1. / dxdX_tmp[2][2];
+            dXdx[3][3] = 1.;
         }
 };
 
@@ -1755,8 +1702,8 @@ class WidepoleTransform {
             Xnative[0] = Xembed[0];
             Xnative[1] = log(Xembed[1]);
             Xnative[3] = Xembed[3];
-            // Treat the special case with a macro
-            ROOT_FIND
+            // No closed form for X2(th)
+            Xnative[2] = root_find_x2(*this, Xembed, Xnative);
         }
         /**
          * Transformation matrix for contravariant vectors to embedding, or covariant vectors to native
@@ -1775,10 +1722,11 @@ class WidepoleTransform {
          */
         KOKKOS_INLINE_FUNCTION void dXdx(const GReal Xnative[GR_DIM], Real dXdx[GR_DIM][GR_DIM]) const
         {
-            // Okay this one should probably stay numerical
+            // dxdX is diagonal
             Real dxdX_tmp[GR_DIM][GR_DIM];
             dxdX(Xnative, dxdX_tmp);
-            invert(&dxdX_tmp[0][0],&dXdx[0][0]);
+            gzero2(dXdx);
+            DLOOP1 dXdx[mu][mu] = 1. / dxdX_tmp[mu][mu];
         }
 };
 
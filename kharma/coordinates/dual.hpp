@@ -0,0 +1,145 @@
+/*
+ *  File: dual.hpp
+ *
+ *  BSD 3-Clause License
+ *
+ *  Copyright (c) 2020, AFD Group at UIUC
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this
+ *     list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ *  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ *  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ *  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "decs.hpp"
+
+#include <type_traits>
+#include <utility>
+
+/**
+ * Forward-mode automatic differentiation w.r.t. the GR_DIM native coordinates.
+ *
+ * A Dual carries a value and its gradient d/dX^mu.  Coordinate systems and transforms which write
+ * gcov_embed, coord_to_embed and dxdX as templates on their scalar type can be evaluated with
+ * Dual arguments, which yields the exact metric derivatives for the connection in one pass,
+ * see CoordinateEmbedding::conn_native.
+ *
+ * Templated functions should call math functions unqualified, with e.g. "using m::sin;" in scope,
+ * so that the overloads below are found for Dual arguments.
+ */
+struct Dual {
+    GReal v;
+    GReal d[GR_DIM];
+
+    // Trivial default constructor, so arrays of Duals can be zeroed like arrays of Reals
+    Dual() = default;
+    KOKKOS_INLINE_FUNCTION Dual(const GReal& val): v(val) { DLOOP1 d[mu] = 0.; }
+
+    // An independent variable, i.e. native coordinate X^seed
+    KOKKOS_INLINE_FUNCTION static Dual variable(const GReal& val, const int& seed)
+    {
+        Dual x(val);
+        x.d[seed] = 1.;
+        return x;
+    }
+
+    KOKKOS_INLINE_FUNCTION Dual& operator+=(const Dual& o) { v += o.v; DLOOP1 d[mu] += o.d[mu]; return *this; }
+    KOKKOS_INLINE_FUNCTION Dual& operator-=(const Dual& o) { v -= o.v; DLOOP1 d[mu] -= o.d[mu]; return *this; }
+    KOKKOS_INLINE_FUNCTION Dual& operator*=(const Dual& o) { DLOOP1 d[mu] = d[mu]*o.v + v*o.d[mu]; v *= o.v; return *this; }
+    KOKKOS_INLINE_FUNCTION Dual& operator/=(const Dual& o) { DLOOP1 d[mu] = (d[mu]*o.v - v*o.d[mu]) / (o.v*o.v); v /= o.v; return *this; }
+};
+
+// Function of a Dual with value f and derivative df at x.v
+KOKKOS_INLINE_FUNCTION Dual dual_chain(const Dual& x, const GReal& f, const GReal& df)
+{
+    Dual y(f);
+    DLOOP1 y.d[mu] = df * x.d[mu];
+    return y;
+}
+
+// Value without derivatives, e.g. for indexing
+KOKKOS_INLINE_FUNCTION GReal value_of(const GReal& x) { return x; }
+KOKKOS_INLINE_FUNCTION GReal value_of(const Dual& x) { return x.v; }
+
+// Arithmetic
+KOKKOS_INLINE_FUNCTION Dual operator+(const Dual& a) { return a; }
+KOKKOS_INLINE_FUNCTION Dual operator-(const Dual& a) { return dual_chain(a, -a.v, -1.); }
+KOKKOS_INLINE_FUNCTION Dual operator+(Dual a, const Dual& b) { return a += b; }
+KOKKOS_INLINE_FUNCTION Dual operator-(Dual a, const Dual& b) { return a -= b; }
+KOKKOS_INLINE_FUNCTION Dual operator*(Dual a, const Dual& b) { return a *= b; }
+KOKKOS_INLINE_FUNCTION Dual operator/(Dual a, const Dual& b) { return a /= b; }
+KOKKOS_INLINE_FUNCTION Dual operator+(const Dual& a, const GReal& b) { return dual_chain(a, a.v + b, 1.); }
+KOKKOS_INLINE_FUNCTION Dual operator+(const GReal& a, const Dual& b) { return dual_chain(b, a + b.v, 1.); }
+KOKKOS_INLINE_FUNCTION Dual operator-(const Dual& a, const GReal& b) { return dual_chain(a, a.v - b, 1.); }
+KOKKOS_INLINE_FUNCTION Dual operator-(const GReal& a, const Dual& b) { return dual_chain(b, a - b.v, -1.); }
+KOKKOS_INLINE_FUNCTION Dual operator*(const Dual& a, const GReal& b) { return dual_chain(a, a.v * b, b); }
+KOKKOS_INLINE_FUNCTION Dual operator*(const GReal& a, const Dual& b) { return dual_chain(b, a * b.v, a); }
+KOKKOS_INLINE_FUNCTION Dual operator/(const Dual& a, const GReal& b) { return dual_chain(a, a.v / b, 1. / b); }
+KOKKOS_INLINE_FUNCTION Dual operator/(const GReal& a, const Dual& b) { return dual_chain(b, a / b.v, -a / (b.v*b.v)); }
+
+// Comparisons act on the value
+KOKKOS_INLINE_FUNCTION bool operator<(const Dual& a, const Dual& b) { return a.v < b.v; }
+KOKKOS_INLINE_FUNCTION bool operator>(const Dual& a, const Dual& b) { return a.v > b.v; }
+KOKKOS_INLINE_FUNCTION bool operator<(const Dual& a, const GReal& b) { return a.v < b; }
+KOKKOS_INLINE_FUNCTION bool operator>(const Dual& a, const GReal& b) { return a.v > b; }
+
+// Math functions.  Found by ADL when called unqualified
+KOKKOS_INLINE_FUNCTION Dual sin(const Dual& x) { return dual_chain(x, m::sin(x.v), m::cos(x.v)); }
+KOKKOS_INLINE_FUNCTION Dual cos(const Dual& x) { return dual_chain(x, m::cos(x.v), -m::sin(x.v)); }
+KOKKOS_INLINE_FUNCTION Dual exp(const Dual& x) { const GReal e = m::exp(x.v); return dual_chain(x, e, e); }
+KOKKOS_INLINE_FUNCTION Dual log(const Dual& x) { return dual_chain(x, m::log(x.v), 1. / x.v); }
+KOKKOS_INLINE_FUNCTION Dual sqrt(const Dual& x) { const GReal s = m::sqrt(x.v); return dual_chain(x, s, 0.5 / s); }
+KOKKOS_INLINE_FUNCTION Dual pow(const Dual& x, const GReal& n)
+{
+    return dual_chain(x, m::pow(x.v, n), (n == 0.) ? 0. : n * m::pow(x.v, n - 1.));
+}
+KOKKOS_INLINE_FUNCTION Dual abs(const Dual& x) { return (x.v < 0.) ? -x : x; }
+KOKKOS_INLINE_FUNCTION Dual max(const Dual& x, const GReal& y) { return (x.v < y) ? Dual(y) : x; }
+
+// Version of excise() in kharma_utils.hpp.  Excised points are constant
+KOKKOS_INLINE_FUNCTION Dual excise(const Dual& n, const GReal& center, const GReal& range)
+{
+    return (m::abs(n.v - center) > range) ? n : Dual((n.v > center) ? center + range : center - range);
+}
+
+/**
+ * Whether a base coordinate system can evaluate gcov_embed with Dual arguments
+ */
+template<typename C, typename = void>
+struct dual_base : std::false_type {};
+template<typename C>
+struct dual_base<C, std::void_t<decltype(std::declval<const C&>().gcov_embed(
+                        std::declval<const Dual*>(), std::declval<Dual (*)[GR_DIM]>()))>> : std::true_type {};
+
+/**
+ * Whether a transform can evaluate coord_to_embed and dxdX with Dual arguments
+ */
+template<typename C, typename = void>
+struct dual_transform : std::false_type {};
+template<typename C>
+struct dual_transform<C, std::void_t<decltype(std::declval<const C&>().coord_to_embed(
+                        std::declval<const Dual*>(), std::declval<Dual*>())),
+                                     decltype(std::declval<const C&>().dxdX(
+                        std::declval<const Dual*>(), std::declval<Dual (*)[GR_DIM]>()))>> : std::true_type {};
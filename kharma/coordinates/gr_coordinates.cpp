@@ -42,6 +42,17 @@
 // types, which are not available when importing this file's header
 #include "types.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
 using Kokkos::MDRangePolicy;
 using Kokkos::Rank;
 
@@ -54,9 +65,12 @@ using Kokkos::Rank;
  */
 GRCoordinates::GRCoordinates(const RegionSize &rs, ParameterInput *pin): UniformCartesian(rs, pin) {}
 GRCoordinates::GRCoordinates(const GRCoordinates &src, int coarsen): UniformCartesian(src, coarsen) {}
+void ClearGeometryStore() { MetricTables().clear(); }
+void GRCoordinates::InitGeometry() {}
 #else
-// Internal function for initializing cache
+// Internal functions for initializing cache
 void init_GRCoordinates(GRCoordinates& G);
+void init_geometry_cache_dir(ParameterInput *pin);
 
 /**
  * Construct a GRCoordinates object with a transformation according to preferences set in the package
@@ -72,6 +86,12 @@ GRCoordinates::GRCoordinates(const RegionSize &rs, ParameterInput *pin): Uniform
 
     connection_average_points = pin->GetOrAddInteger("coordinates", "connection_average_points", 1);
     correct_connections = pin->GetOrAddBoolean("coordinates", "correct_connections", false);
+    dual_connection = pin->GetOrAddBoolean("coordinates", "dual_connection", false);
+    if (dual_connection && !coords.supports_dual())
+        throw std::runtime_error("Exact connection coefficients are not supported in coordinates "+coords.variant_names()+"!");
+    share_geometry = pin->GetOrAddBoolean("coordinates", "share_geometry", true);
+    lazy_coarse_geometry = pin->GetOrAddBoolean("coordinates", "lazy_coarse_geometry", true);
+    init_geometry_cache_dir(pin);
 
     init_GRCoordinates(*this);
 }
@@ -79,10 +99,232 @@ GRCoordinates::GRCoordinates(const RegionSize &rs, ParameterInput *pin): Uniform
 GRCoordinates::GRCoordinates(const GRCoordinates &src, int coarsen): UniformCartesian(src, coarsen),
     coords(src.coords), n1(src.n1/coarsen), n2(src.n2/coarsen), n3(src.n3/coarsen),
     connection_average_points(src.connection_average_points),
-    correct_connections(src.correct_connections)
+    correct_connections(src.correct_connections), dual_connection(src.dual_connection),
+    share_geometry(src.share_geometry), lazy_coarse_geometry(src.lazy_coarse_geometry)
 {
     //std::cerr << "Calling coarsen constructor" << std::endl;
-    init_GRCoordinates(*this);
+    // Coarse coordinates are constructed for every block under SMR/AMR, but KHARMA's
+    // boundary & prolongation code only uses their cell sizes & volumes.  Defer the geometry
+    // until something asks for it with InitGeometry()
+    if (!lazy_coarse_geometry) init_GRCoordinates(*this);
+}
+
+void GRCoordinates::InitGeometry()
+{
+    if (!geometry_initialized) init_GRCoordinates(*this);
+}
+
+/**
+ * Mesh-wide store of geometry caches.  All of the cached geometry is a function of X1 & X2 only,
+ * so blocks differing only in X3 (e.g., all the blocks around the axis in spherical coordinates)
+ * can share the same arrays.  Since the coordinate system is the same for all blocks, the X1/X2 extents
+ * and sizes of a block (which together encode its refinement level) determine its cache completely.
+ *
+ * Nothing writes to the caches after initialization, so sharing by reference is safe.
+ * Entries which are no longer referenced by any block are dropped whenever a new entry is added,
+ * e.g. after remeshing.
+ */
+namespace {
+struct GeometryKey {
+    GReal x1min, x1max, x2min, x2max;
+    int n1, n2, connection_average_points;
+    bool correct_connections, dual_connection;
+    bool operator<(const GeometryKey& o) const
+    {
+        return std::tie(x1min, x1max, x2min, x2max, n1, n2, connection_average_points, correct_connections, dual_connection)
+             < std::tie(o.x1min, o.x1max, o.x2min, o.x2max, o.n1, o.n2, o.connection_average_points, o.correct_connections,
+                        o.dual_connection);
+    }
+};
+struct GeometryEntry {
+    GeomTensor2 gcon, gcov;
+    GeomScalar gdet;
+    GeomTensor3 conn, gdet_conn;
+    GeomTensor2 adm;
+    GeomScalar r, th;
+    GeomTensor2 bl;
+};
+std::map<GeometryKey, GeometryEntry> GeometryStore;
+
+GeometryKey geometry_key(const GRCoordinates& G)
+{
+    return GeometryKey{G.Xf<1>(0), G.Xf<1>(G.n1), G.Xf<2>(0), G.Xf<2>(G.n2),
+                       G.n1, G.n2, G.connection_average_points, G.correct_connections, G.dual_connection};
+}
+
+/**
+ * Optional on-disk copy of the geometry store, for expensive metrics & many short runs (e.g. multizone).
+ * Files are named by a hash of the whole <coordinates> block, the mesh extents & GeometryKey, and hold
+ * the raw cache arrays.
+ * See coordinates/geometry_cache_dir
+ */
+std::string GeometryCacheDir;
+uint64_t GeometryParamHash = 0;
+constexpr char geometry_cache_magic[8] = {'K', 'H', 'G', 'E', 'O', 'M', '0', '1'};
+
+// FNV-1a, so that hashes (and therefore file names) don't change between builds
+uint64_t fnv1a(const std::string& s)
+{
+    uint64_t h = 14695981039346656037ull;
+    for (const char c : s) {
+        h ^= (unsigned char) c;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+std::string geometry_cache_file(const GeometryKey& key)
+{
+    std::ostringstream desc;
+    desc << std::setprecision(17) << GeometryParamHash << " " << key.x1min << " " << key.x1max << " "
+         << key.x2min << " " << key.x2max << " " << key.n1 << " " << key.n2 << " " << key.connection_average_points
+         << " " << key.correct_connections << " " << key.dual_connection << " " << sizeof(Real);
+    std::ostringstream fname;
+    fname << GeometryCacheDir << "/geometry_" << std::hex << std::setw(16) << std::setfill('0') << fnv1a(desc.str()) << ".bin";
+    return fname.str();
+}
+
+// Every cache array which is a function of X1 & X2, in file order
+std::vector<GeomScalar*> cache_arrays(GRCoordinates& G)
+{
+    std::vector<GeomScalar*> arrays = {&G.gcon_direct, &G.gcov_direct, &G.gdet_direct,
+                                       &G.conn_direct, &G.gdet_conn_direct, &G.adm_direct};
+    if (G.sph_cached) {
+        arrays.push_back(&G.r_direct);
+        arrays.push_back(&G.th_direct);
+    }
+    if (G.coords.has_bl()) arrays.push_back(&G.bl_direct);
+    return arrays;
+}
+
+/**
+ * Fill G's (allocated) caches from 'fname'.  Returns false, leaving any partial read to be overwritten,
+ * if the file is missing or doesn't match
+ */
+bool read_geometry_cache(GRCoordinates& G, const std::string& fname)
+{
+    FILE *fp = fopen(fname.c_str(), "rb");
+    if (fp == nullptr) return false;
+    bool good = true;
+    char magic[8];
+    uint64_t hash;
+    good = fread(magic, sizeof(magic), 1, fp) == 1 && std::equal(magic, magic + 8, geometry_cache_magic)
+           && fread(&hash, sizeof(hash), 1, fp) == 1 && hash == GeometryParamHash;
+    for (auto array : cache_arrays(G)) {
+        if (!good) break;
+        auto host = array->GetHostMirror();
+        auto hview = host.KokkosView();
+        uint64_t size;
+        good = fread(&size, sizeof(size), 1, fp) == 1 && size == hview.size()
+               && fread(hview.data(), sizeof(Real), size, fp) == size;
+        if (good) array->DeepCopy(host);
+    }
+    fclose(fp);
+    return good;
+}
+
+void write_geometry_cache(GRCoordinates& G, const std::string& fname)
+{
+    // Ranks computing the same geometry race to write it: write privately, then move into place
+    const std::string tmpname = fname + ".tmp" + std::to_string(MPIRank());
+    FILE *fp = fopen(tmpname.c_str(), "wb");
+    if (fp == nullptr) {
+        std::cerr << "KHARMA WARNING: could not write geometry cache " << fname << std::endl;
+        return;
+    }
+    bool good = fwrite(geometry_cache_magic, sizeof(geometry_cache_magic), 1, fp) == 1
+                && fwrite(&GeometryParamHash, sizeof(GeometryParamHash), 1, fp) == 1;
+    for (auto array : cache_arrays(G)) {
+        if (!good) break;
+        auto host = array->GetHostMirrorAndCopy();
+        auto hview = host.KokkosView();
+        const uint64_t size = hview.size();
+        good = fwrite(&size, sizeof(size), 1, fp) == 1
+               && fwrite(hview.data(), sizeof(Real), size, fp) == size;
+    }
+    // fclose flushes, so it can fail too
+    good = (fclose(fp) == 0) && good;
+    // Never move a partial file into place, where other runs would trust it
+    if (!good || std::rename(tmpname.c_str(), fname.c_str()) != 0) {
+        std::cerr << "KHARMA WARNING: could not write geometry cache " << fname << std::endl;
+        std::remove(tmpname.c_str());
+    }
+}
+
+void prune_geometry_store()
+{
+    for (auto it = GeometryStore.begin(); it != GeometryStore.end();) {
+        // Copy the View out, so the count is the same whether or not KokkosView() returns a reference:
+        // one reference from the store, one from the copy
+        auto view = it->second.gcon.KokkosView();
+        if (view.use_count() <= 2) {
+            it = GeometryStore.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+void store_geometry(const GRCoordinates& G, const GeometryKey& key)
+{
+    if (G.share_geometry) {
+        prune_geometry_store();
+        GeometryStore[key] = GeometryEntry{G.gcon_direct, G.gcov_direct, G.gdet_direct,
+                                           G.conn_direct, G.gdet_conn_direct, G.adm_direct,
+                                           G.r_direct, G.th_direct, G.bl_direct};
+    }
+}
+} // anonymous namespace
+
+/**
+ * Record the cache directory, and hash every parameter which could change the geometry for a given grid
+ */
+void init_geometry_cache_dir(ParameterInput *pin)
+{
+    GeometryCacheDir = pin->GetOrAddString("coordinates", "geometry_cache_dir", "");
+    if (GeometryCacheDir.empty()) return;
+
+    // Create the directory the first time we see it.  If we can't, run without the cache
+    static std::string checked_dir;
+    static bool dir_ok = false;
+    if (GeometryCacheDir != checked_dir) {
+        checked_dir = GeometryCacheDir;
+        std::error_code ec;
+        std::filesystem::create_directories(GeometryCacheDir, ec);
+        dir_ok = !ec && std::filesystem::is_directory(GeometryCacheDir, ec);
+        if (!dir_ok && MPIRank0())
+            std::cerr << "KHARMA WARNING: could not create geometry_cache_dir " << GeometryCacheDir
+                      << ", disabling the geometry cache" << std::endl;
+    }
+    if (!dir_ok) {
+        GeometryCacheDir = "";
+        return;
+    }
+
+    // Hash the whole <coordinates> block, so that no parameter can be forgotten: anything which doesn't
+    // change the geometry just costs a cache miss.  Defaults are filled in by CoordinateEmbedding's
+    // constructor, which runs first.  Some transforms also depend on the mesh, see CoordinateEmbedding
+    static const std::vector<std::string> mesh_params = {"x1min", "x1max", "x2min", "x2max", "x3min", "x3max",
+                                                         "nx1", "nx2", "nx3"};
+    std::map<std::string, std::string> params;
+    for (InputBlock *pib = pin->pfirst_block; pib != nullptr; pib = pib->pnext) {
+        if (pib->block_name != "coordinates") continue;
+        for (InputLine *pil = pib->pline; pil != nullptr; pil = pil->pnext)
+            if (pil->param_name != "geometry_cache_dir")
+                params["coordinates/" + pil->param_name] = pil->param_value;
+    }
+    for (const auto& name : mesh_params)
+        if (pin->DoesParameterExist("parthenon/mesh", name))
+            params["parthenon/mesh/" + name] = pin->GetString("parthenon/mesh", name);
+    std::string desc;
+    for (const auto& param : params)
+        desc += param.first + "=" + param.second + ";";
+    GeometryParamHash = fnv1a(desc);
+}
+
+void ClearGeometryStore()
+{
+    GeometryStore.clear();
+    MetricTables().clear();
 }
 
 /**
@@ -98,15 +340,66 @@ void init_GRCoordinates(GRCoordinates& G) {
     const int n2 = G.n2;
     const int n3 = G.n3;
     const bool correct_connections = G.correct_connections;
+    const bool dual_connection = G.dual_connection;
     const int connection_average_points = G.connection_average_points;
+    G.geometry_initialized = true;
+
+    // Embedding coordinates in spherical systems.  phi depends on X3 and so is never shared
+    G.sph_cached = G.coords.is_spherical();
+    if (G.sph_cached) {
+        G.phi_direct = GeomScalar("phi", NLOC, n3+1);
+        auto phi_local = G.phi_direct;
+        Kokkos::parallel_for("init_phi", MDRangePolicy<Rank<2>>({0,0}, {NLOC, n3+1}),
+            KOKKOS_LAMBDA (const int& iloc, const int& k) {
+                GReal X[GR_DIM];
+                G.coord(k, 0, 0, (Loci) iloc, X);
+                phi_local(iloc, k) = G.coords.phi_of(X);
+            }
+        );
+    }
+
+    // Use any existing cache for this X1/X2 grid
+    const GeometryKey key = geometry_key(G);
+    if (G.share_geometry) {
+        auto found = GeometryStore.find(key);
+        if (found != GeometryStore.end()) {
+            const GeometryEntry& e = found->second;
+            G.gcon_direct = e.gcon;
+            G.gcov_direct = e.gcov;
+            G.gdet_direct = e.gdet;
+            G.conn_direct = e.conn;
+            G.gdet_conn_direct = e.gdet_conn;
+            G.adm_direct = e.adm;
+            G.r_direct = e.r;
+            G.th_direct = e.th;
+            G.bl_direct = e.bl;
+            return;
+        }
+    }
 
     //cerr << "Creating GRCoordinate cache size " << n1 << " " << n2 << std::endl;
     // Cache geometry.  May be faster than re-computing. May not be.
-    G.gcon_direct = GeomTensor2("gcon", NLOC, n2+1, n1+1, GR_DIM, GR_DIM);
-    G.gcov_direct = GeomTensor2("gcov", NLOC, n2+1, n1+1, GR_DIM, GR_DIM);
+    // Symmetric pairs of indices are stored packed, see sym4()
+    G.gcon_direct = GeomTensor2("gcon", NLOC, n2+1, n1+1, GR_SYM);
+    G.gcov_direct = GeomTensor2("gcov", NLOC, n2+1, n1+1, GR_SYM);
     G.gdet_direct = GeomScalar("gdet", NLOC, n2+1, n1+1);
-    G.conn_direct = GeomTensor3("conn", n2, n1, GR_DIM, GR_DIM, GR_DIM);
-    G.gdet_conn_direct = GeomTensor3("conn", n2, n1, GR_DIM, GR_DIM, GR_DIM);
+    G.conn_direct = GeomTensor3("conn", n2, n1, GR_DIM, GR_SYM);
+    G.gdet_conn_direct = GeomTensor3("conn", n2, n1, GR_DIM, GR_SYM);
+    G.adm_direct = GeomTensor2("adm", NADM, NLOC, n2+1, n1+1);
+    if (G.sph_cached) {
+        G.r_direct = GeomScalar("r", NLOC, n1+1);
+        G.th_direct = GeomScalar("th", NLOC, n2+1, n1+1);
+    }
+    const bool sph_cached = G.sph_cached;
+    const bool has_bl = G.coords.has_bl();
+    if (has_bl) G.bl_direct = GeomTensor2("bl_trans", n2, n1, NBL);
+
+    // Or one on disk
+    const std::string cache_file = GeometryCacheDir.empty() ? "" : geometry_cache_file(key);
+    if (!cache_file.empty() && read_geometry_cache(G, cache_file)) {
+        store_geometry(G, key);
+        return;
+    }
 
     // Member variables have an implicit this->
     // C++ Lambdas (and therefore Kokkos Lambdas) capture pointers to objects, not full objects
@@ -116,13 +409,25 @@ void init_GRCoordinates(GRCoordinates& G) {
     auto gdet_local = G.gdet_direct;
     auto conn_local = G.conn_direct;
     auto gdet_conn_local = G.gdet_conn_direct;
+    auto adm_local = G.adm_direct;
+    auto r_local = G.r_direct;
+    auto th_local = G.th_direct;
+    auto bl_local = G.bl_direct;
 
+    // Everything local to a point is computed in this one kernel: the (averaged) metric & connection,
+    // its 3+1 split, the embedding coordinates r & th, and the transformation from BL
     Kokkos::parallel_for("init_geom", MDRangePolicy<Rank<2>>({0,0}, {n2+1, n1+1}),
         KOKKOS_LAMBDA (const int& j, const int& i) {
             // Iterate through locations. This could be done in fancy ways, but
             // this highlights what's actually going on.
             for (int iloc =0; iloc < NLOC; iloc++) {
                 Loci loc = (Loci) iloc;
+                if (sph_cached) {
+                    GReal X[GR_DIM];
+                    G.coord(0, j, i, loc, X);
+                    th_local(iloc, j, i) = G.coords.th_of(X);
+                    if (j == 0) r_local(iloc, i) = G.coords.r_of(X);
+                }
                 // radius of points to sample, floor(npoints/2)
                 const int radius = connection_average_points / 2;
                 const int diameter = connection_average_points;
@@ -148,21 +453,31 @@ void init_GRCoordinates(GRCoordinates& G) {
                             const GReal gdet = G.coords.gcon_from_gcov(gcov_loc, gcon_loc);
                             // Add to running averages
                             gdet_local(loc, j, i) += gdet / square;
-                            DLOOP2 {
-                                gcov_local(loc, j, i, mu, nu) += gcov_loc[mu][nu] / square;
-                                gcon_local(loc, j, i, mu, nu) += gcon_loc[mu][nu] / square;
+                            DLOOP2 if (nu >= mu) {
+                                gcov_local(loc, j, i, sym4(mu, nu)) += gcov_loc[mu][nu] / square;
+                                gcon_local(loc, j, i, sym4(mu, nu)) += gcon_loc[mu][nu] / square;
                             }
                             if (loc == Loci::center) {
                                 // In the center, get the connection and gdet*connection
                                 Real conn_loc[GR_DIM][GR_DIM][GR_DIM];
-                                G.coords.conn_native(X, DELTA, conn_loc);
-                                DLOOP3 {
-                                    conn_local(j, i, mu, nu, lam) += conn_loc[mu][nu][lam] / square;
-                                    gdet_conn_local(j, i, mu, nu, lam) += gdet*conn_loc[mu][nu][lam] / square;
+                                G.coords.conn_native(X, DELTA, conn_loc, dual_connection);
+                                DLOOP3 if (lam >= nu) {
+                                    conn_local(j, i, mu, sym4(nu, lam)) += conn_loc[mu][nu][lam] / square;
+                                    gdet_conn_local(j, i, mu, sym4(nu, lam)) += gdet*conn_loc[mu][nu][lam] / square;
                                 }
                             }
                         }
                     }
+                    if (loc == Loci::center && has_bl) {
+                        // Transformation from BL, for initializing velocities
+                        GReal X[GR_DIM], gcov_bl[GR_DIM][GR_DIM], trans[GR_DIM][GR_DIM];
+                        G.coord(0, j, i, loc, X);
+                        G.coords.bl_to_native_transform(X, gcov_bl, trans);
+                        DLOOP2 {
+                            if (nu >= mu) bl_local(j, i, sym4(mu, nu)) = gcov_bl[mu][nu];
+                            bl_local(j, i, GR_SYM + GR_DIM*mu + nu) = trans[mu][nu];
+                        }
+                    }
                 } else if (loc == Loci::face1 || loc == Loci::face2) {
                     for (int k=-radius; k <= radius; k++) {
                         // Like the above, but only average over a particular face (line for 2D geometry)
@@ -180,9 +495,9 @@ void init_GRCoordinates(GRCoordinates& G) {
                         const GReal gdet = G.coords.gcon_from_gcov(gcov_loc, gcon_loc);
                         // Add to running averages
                         gdet_local(loc, j, i) += gdet / diameter;
-                        DLOOP2 {
-                            gcov_local(loc, j, i, mu, nu) += gcov_loc[mu][nu] / diameter;
-                            gcon_local(loc, j, i, mu, nu) += gcon_loc[mu][nu] / diameter;
+                        DLOOP2 if (nu >= mu) {
+                            gcov_local(loc, j, i, sym4(mu, nu)) += gcov_loc[mu][nu] / diameter;
+                            gcon_local(loc, j, i, sym4(mu, nu)) += gcon_loc[mu][nu] / diameter;
                         }
                     }
                 } else { // corner
@@ -195,9 +510,22 @@ void init_GRCoordinates(GRCoordinates& G) {
                     const GReal gdet = G.coords.gcon_from_gcov(gcov_loc, gcon_loc);
                     // Set geometry
                     gdet_local(loc, j, i) = gdet;
-                    DLOOP2 {
-                        gcov_local(loc, j, i, mu, nu) = gcov_loc[mu][nu];
-                        gcon_local(loc, j, i, mu, nu) = gcon_loc[mu][nu];
+                    DLOOP2 if (nu >= mu) {
+                        gcov_local(loc, j, i, sym4(mu, nu)) = gcov_loc[mu][nu];
+                        gcon_local(loc, j, i, sym4(mu, nu)) = gcon_loc[mu][nu];
+                    }
+                }
+
+                // Split the (possibly averaged) metric into 3+1 form.
+                // Centers & X3 faces past the last zone were skipped above
+                const GReal gcon00 = gcon_local(iloc, j, i, sym4(0, 0));
+                adm_local(adm_alpha, iloc, j, i) = 1. / m::sqrt(-gcon00);
+                for (int mu = 1; mu < GR_DIM; ++mu) {
+                    adm_local(adm_alpha + mu, iloc, j, i) = -gcon_local(iloc, j, i, sym4(0, mu)) / gcon00;
+                    for (int nu = mu; nu < GR_DIM; ++nu) {
+                        adm_local(adm_gcov11 + sym3(mu, nu), iloc, j, i) = gcov_local(iloc, j, i, sym4(mu, nu));
+                        adm_local(adm_gcon11 + sym3(mu, nu), iloc, j, i) = gcon_local(iloc, j, i, sym4(mu, nu))
+                                            - gcon_local(iloc, j, i, sym4(0, mu)) * gcon_local(iloc, j, i, sym4(0, nu)) / gcon00;
                     }
                 }
             }
@@ -227,8 +555,8 @@ void init_GRCoordinates(GRCoordinates& G) {
                         GReal test_sum = 0;
                         GReal sum_portions, portions[GR_DIM] = {0};
                         DLOOP1 {
-                            test_sum += gdet_conn_local(j, i, mu, mu, lam);
-                            portions[mu] = m::abs(gdet_conn_local(j, i, mu, mu, lam));
+                            test_sum += gdet_conn_local(j, i, mu, sym4(mu, lam));
+                            portions[mu] = m::abs(gdet_conn_local(j, i, mu, sym4(mu, lam)));
                             sum_portions += portions[mu];
                         }
                         DLOOP1 portions[mu] /= sum_portions;
@@ -236,14 +564,15 @@ void init_GRCoordinates(GRCoordinates& G) {
 
                         // Add the difference among components equally
                         const GReal diff = test_sum - target;
-                        DLOOP1 gdet_conn_local(j, i, mu, mu, lam) = gdet_conn_local(j, i, mu, mu, lam) - diff*portions[mu];
-
-                        // This is separated and set equal, as there will be one self-assignment
-                        DLOOP1 gdet_conn_local(j, i, mu, lam, mu) = gdet_conn_local(j, i, mu, mu, lam);
+                        // Packed storage keeps the lower indices symmetric: (mu, mu, lam) and (mu, lam, mu) are one entry
+                        DLOOP1 gdet_conn_local(j, i, mu, sym4(mu, lam)) = gdet_conn_local(j, i, mu, sym4(mu, lam)) - diff*portions[mu];
                     }
                 }
             }
         );
     }
+
+    if (!cache_file.empty()) write_geometry_cache(G, cache_file);
+    store_geometry(G, key);
 }
 #endif // FAST_CARTESIAN
@@ -45,6 +45,7 @@
 // places in parthenon and expected to be benign
 #include <coordinates/uniform_cartesian.hpp>
 #include <parameter_input.hpp>
+#include <utils/error_checking.hpp>
 
 // This import should always be okay, too
 #include "Kokkos_Core.hpp"
@@ -55,6 +56,24 @@
 // Don't cache values of the metric, etc, just call into CoordinateEmbedding directly
 #define NO_CACHE 0
 
+// Components of the 3+1 geometry cache: lapse, shift, and the spatial metric & its inverse.
+// The symmetric 3x3 tensors store only the upper triangle, see sym3()
+enum ADM : int {adm_alpha=0, adm_beta1, adm_beta2, adm_beta3,
+                adm_gcov11, adm_gcov12, adm_gcov13, adm_gcov22, adm_gcov23, adm_gcov33,
+                adm_gcon11, adm_gcon12, adm_gcon13, adm_gcon22, adm_gcon23, adm_gcon33};
+#define NADM 16
+
+// Size of the cached transformation from Boyer-Lindquist: the BL metric (packed, see sym4())
+// followed by the BL->native matrix, see CoordinateEmbedding::bl_to_native_transform
+#define NBL (GR_SYM + GR_DIM*GR_DIM)
+// Index of spatial component (mu, nu), with mu,nu in 1..3, in an upper-triangular 3x3 list
+KOKKOS_FORCEINLINE_FUNCTION int sym3(const int& mu, const int& nu)
+{
+    const int lo = ((mu < nu) ? mu : nu) - 1;
+    const int hi = ((mu < nu) ? nu : mu) - 1;
+    return lo*3 - (lo*(lo-1))/2 + (hi - lo);
+}
+
 /**
  * Replacement/extension coordinate class for Parthenon
  * 
@@ -82,11 +101,38 @@ public:
     // metric determinant derivatives discretized at faces
     bool correct_connections = false;
 
+    // Whether to compute the connection coefficients with exact derivatives of the metric, see dual.hpp
+    bool dual_connection = false;
+
+    // Whether to share geometry caches between blocks with the same X1 & X2 grid,
+    // see GeometryStore in gr_coordinates.cpp
+    bool share_geometry = true;
+
+    // Whether r, th, phi are cached below.  Only possible for spherical systems, where they are
+    // functions of X1, (X1, X2) and X3 respectively
+    bool sph_cached = false;
+
+    // Whether coarse-buffer coordinates (for SMR/AMR) build their geometry caches only
+    // on request, with InitGeometry().  Fine coordinates are always initialized.
+    // Host code handing coarse coordinates to a kernel which reads the metric must call InitGeometry()
+    // first: kernels can't build the caches, but debug builds check every cached access
+    bool lazy_coarse_geometry = true;
+    bool geometry_initialized = false;
+
     // Caches for geometry values at zone centers/faces/etc
+    // Symmetric index pairs are packed, see sym4(): gcon/gcov are (loc, j, i, sym4(mu, nu)),
+    // and conn/gdet_conn are (j, i, mu, sym4(nu, lam))
 #if !FAST_CARTESIAN && !NO_CACHE
     GeomTensor2 gcon_direct, gcov_direct;
     GeomScalar gdet_direct;
     GeomTensor3 conn_direct, gdet_conn_direct;
+    // 3+1 split of the metric, (component, loc, j, i) i.e. structure-of-arrays,
+    // so kernels working along rows of faces get unit-stride loads of just what they use
+    GeomTensor2 adm_direct;
+    // Embedding coordinates r (loc, i), th (loc, j, i), phi (loc, k)
+    GeomScalar r_direct, th_direct, phi_direct;
+    // Transformation from BL at zone centers (j, i, NBL), for systems which have a BL form
+    GeomTensor2 bl_direct;
 #endif
 
     // "Full" constructors which generate new geometry caches
@@ -102,7 +148,9 @@ public:
     KOKKOS_FUNCTION GRCoordinates(const GRCoordinates &src): UniformCartesian(src),
         n1(src.n1), n2(src.n2), n3(src.n3), coords(src.coords),
         connection_average_points(src.connection_average_points),
-        correct_connections(src.correct_connections)
+        correct_connections(src.correct_connections), dual_connection(src.dual_connection),
+        share_geometry(src.share_geometry), sph_cached(src.sph_cached),
+        lazy_coarse_geometry(src.lazy_coarse_geometry), geometry_initialized(src.geometry_initialized)
     {
         //std::cerr << "Calling copy constructor size " << src.n1 << " " << src.n2 << std::endl;
 #if !FAST_CARTESIAN && !NO_CACHE
@@ -111,6 +159,11 @@ public:
         gdet_direct = src.gdet_direct;
         conn_direct = src.conn_direct;
         gdet_conn_direct = src.gdet_conn_direct;
+        adm_direct = src.adm_direct;
+        r_direct = src.r_direct;
+        th_direct = src.th_direct;
+        phi_direct = src.phi_direct;
+        bl_direct = src.bl_direct;
 #endif
     };
 
@@ -125,16 +178,29 @@ public:
         n3 = src.n3;
         connection_average_points = src.connection_average_points;
         correct_connections = src.correct_connections;
+        dual_connection = src.dual_connection;
+        share_geometry = src.share_geometry;
+        sph_cached = src.sph_cached;
+        lazy_coarse_geometry = src.lazy_coarse_geometry;
+        geometry_initialized = src.geometry_initialized;
 #if !FAST_CARTESIAN && !NO_CACHE
         gcon_direct = src.gcon_direct;
         gcov_direct = src.gcov_direct;
         gdet_direct = src.gdet_direct;
         conn_direct = src.conn_direct;
         gdet_conn_direct = src.gdet_conn_direct;
+        adm_direct = src.adm_direct;
+        r_direct = src.r_direct;
+        th_direct = src.th_direct;
+        phi_direct = src.phi_direct;
+        bl_direct = src.bl_direct;
 #endif
         return *this;
     };
 
+    // Build the geometry caches of coarse coordinates, if they were deferred.  Host-side only
+    void InitGeometry();
+
     // Correct the coordinate system name for outputs.
     // So far the only override we need.
     const char *Name() const {
@@ -159,11 +225,18 @@ public:
     KOKKOS_INLINE_FUNCTION void conn(const int& j, const int& i, Real conn[GR_DIM][GR_DIM][GR_DIM]) const;
     KOKKOS_INLINE_FUNCTION void gdet_conn(const int& j, const int& i, Real conn[GR_DIM][GR_DIM][GR_DIM]) const;
 
+    // 3+1 quantities: lapse alpha, shift beta^mu, spatial metric gamma_{mu nu} and its inverse gamma^{mu nu}.
+    // Spatial indices run 1..3, as with the full metric
+    KOKKOS_INLINE_FUNCTION Real lapse(const Loci loc, const int& j, const int& i) const;
+    KOKKOS_INLINE_FUNCTION Real shift(const Loci loc, const int& j, const int& i, const int mu) const;
+    KOKKOS_INLINE_FUNCTION Real gamma_cov(const Loci loc, const int& j, const int& i, const int mu, const int nu) const;
+    KOKKOS_INLINE_FUNCTION Real gamma_con(const Loci loc, const int& j, const int& i, const int mu, const int nu) const;
+
     // Coordinates of the GRCoordinates, i.e. "native"
     KOKKOS_INLINE_FUNCTION void coord(const int& k, const int& j, const int& i, const Loci& loc, GReal X[GR_DIM]) const;
     // Coordinates of the embedding system, usually r,th,phi[KS] or x1,x2,x3[Cartesian]
     KOKKOS_INLINE_FUNCTION void coord_embed(const int& k, const int& j, const int& i, const Loci& loc, GReal Xembed[GR_DIM]) const;
-    // Coordinates in specific systems (slow!)
+    // Coordinates in specific systems.  Cached for spherical systems, otherwise slow!
     KOKKOS_INLINE_FUNCTION GReal r(const int& k, const int& j, const int& i, const Loci& loc=Loci::center) const;
     KOKKOS_INLINE_FUNCTION GReal th(const int& k, const int& j, const int& i, const Loci& loc=Loci::center) const;
     KOKKOS_INLINE_FUNCTION GReal phi(const int& k, const int& j, const int& i, const Loci& loc=Loci::center) const;
@@ -176,8 +249,21 @@ public:
                                         const int& k, const int& j, const int& i, const Loci loc) const;
     KOKKOS_INLINE_FUNCTION void raise(const Real vcov[GR_DIM], Real vcon[GR_DIM],
                                         const int& k, const int& j, const int& i, const Loci loc) const;
+    // Lower using the 3+1 cache, which needs 10 loads rather than 16
+    KOKKOS_INLINE_FUNCTION void lower_3p1(const Real vcon[GR_DIM], Real vcov[GR_DIM],
+                                        const int& j, const int& i, const Loci loc) const;
+    // Set u^t of a BL velocity and transform it to native coordinates, at a zone center
+    KOKKOS_INLINE_FUNCTION void bl_fourvel_to_native(const int& k, const int& j, const int& i,
+                                        const Real ucon_bl[GR_DIM], Real ucon_native[GR_DIM]) const;
 };
 
+/**
+ * Drop the references held by the shared geometry store and metric tables (see tabulated_metric.hpp).
+ * Must be called before Kokkos is finalized, as both are static and would otherwise free device memory
+ * after Kokkos shuts down
+ */
+void ClearGeometryStore();
+
 /**
  * Function to return native coordinates on the GRCoordinates
  */
@@ -226,6 +312,42 @@ KOKKOS_INLINE_FUNCTION void GRCoordinates::raise(const Real vcov[GR_DIM], Real v
     gzero(vcon);
     DLOOP2 vcon[mu] += gcon(loc, j, i, mu, nu) * vcov[nu];
 }
+/**
+ * Lower a vector with the 3+1 form of the metric:
+ * v_i = gamma_ij (v^j + beta^j v^0), v_0 = -alpha^2 v^0 + beta^i v_i
+ */
+KOKKOS_INLINE_FUNCTION void GRCoordinates::lower_3p1(const Real vcon[GR_DIM], Real vcov[GR_DIM],
+                                        const int& j, const int& i, const Loci loc) const
+{
+    const Real alpha = lapse(loc, j, i);
+    Real vshift[GR_DIM];
+    for (int mu = 1; mu < GR_DIM; ++mu) vshift[mu] = vcon[mu] + shift(loc, j, i, mu) * vcon[0];
+    vcov[0] = -alpha * alpha * vcon[0];
+    for (int mu = 1; mu < GR_DIM; ++mu) {
+        vcov[mu] = 0;
+        for (int nu = 1; nu < GR_DIM; ++nu) vcov[mu] += gamma_cov(loc, j, i, mu, nu) * vshift[nu];
+        vcov[0] += shift(loc, j, i, mu) * vcov[mu];
+    }
+}
+
+KOKKOS_INLINE_FUNCTION void GRCoordinates::bl_fourvel_to_native(const int& k, const int& j, const int& i,
+                                        const Real ucon_bl[GR_DIM], Real ucon_native[GR_DIM]) const
+{
+#if !FAST_CARTESIAN && !NO_CACHE
+    if (bl_direct.GetDim(1) == NBL) {
+        GReal gcov_bl[GR_DIM][GR_DIM], trans[GR_DIM][GR_DIM];
+        DLOOP2 {
+            gcov_bl[mu][nu] = bl_direct(j, i, sym4(mu, nu));
+            trans[mu][nu] = bl_direct(j, i, GR_SYM + GR_DIM*mu + nu);
+        }
+        CoordinateEmbedding::bl_fourvel_to_native(gcov_bl, trans, ucon_bl, ucon_native);
+        return;
+    }
+#endif
+    GReal Xnative[GR_DIM];
+    coord(k, j, i, Loci::center, Xnative);
+    coords.bl_fourvel_to_native(Xnative, ucon_bl, ucon_native);
+}
 
 // Three different implementations of the metric functions:
 // FAST_CARTESIAN: Minkowski space constant values
@@ -251,6 +373,14 @@ KOKKOS_INLINE_FUNCTION void GRCoordinates::conn(const int& j, const int& i, Real
 {DLOOP3 conn[mu][nu][lam] = 0;}
 KOKKOS_INLINE_FUNCTION void GRCoordinates::gdet_conn(const int& j, const int& i, Real gdet_conn[GR_DIM][GR_DIM][GR_DIM]) const
 {DLOOP3 gdet_conn[mu][nu][lam] = 0;}
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::lapse(const Loci loc, const int& j, const int& i) const
+{ return 1; }
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::shift(const Loci loc, const int& j, const int& i, const int mu) const
+{ return 0; }
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::gamma_cov(const Loci loc, const int& j, const int& i, const int mu, const int nu) const
+{ return (mu == nu); }
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::gamma_con(const Loci loc, const int& j, const int& i, const int mu, const int nu) const
+{ return (mu == nu); }
 #elif NO_CACHE
 // TODO these are currently VERY SLOW.  Rework them to generate just the desired component. (TODO gdet?...)
 // Except conn.  We never need conn fast.
@@ -300,26 +430,48 @@ KOKKOS_INLINE_FUNCTION void GRCoordinates::conn(const int& j, const int& i, Real
     coord(0, j, i, Loci::center, X);
     coords.conn_native(X, conn);
 }
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::lapse(const Loci loc, const int& j, const int& i) const
+{ return 1. / m::sqrt(-gcon(loc, j, i, 0, 0)); }
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::shift(const Loci loc, const int& j, const int& i, const int mu) const
+{ return -gcon(loc, j, i, 0, mu) / gcon(loc, j, i, 0, 0); }
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::gamma_cov(const Loci loc, const int& j, const int& i, const int mu, const int nu) const
+{ return gcov(loc, j, i, mu, nu); }
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::gamma_con(const Loci loc, const int& j, const int& i, const int mu, const int nu) const
+{ return gcon(loc, j, i, mu, nu) - gcon(loc, j, i, 0, mu) * gcon(loc, j, i, 0, nu) / gcon(loc, j, i, 0, 0); }
 #else
+// Debug builds check that (j, i) is inside each cache, which also catches caches never built by InitGeometry(),
+// e.g. on coarse coordinates with lazy_coarse_geometry.  The arguments are the dimensions of j & i, fastest=1
+#define GEOMETRY_CHECK(view, jdim, idim) \
+    PARTHENON_DEBUG_REQUIRE(j >= 0 && j < (view).GetDim(jdim) && i >= 0 && i < (view).GetDim(idim), \
+                            "Geometry accessed outside its cache, or before InitGeometry()")
 KOKKOS_INLINE_FUNCTION Real GRCoordinates::gcon(const Loci loc, const int& j, const int& i, const int mu, const int nu) const
-{ return gcon_direct(loc, j, i, mu, nu); }
+{ GEOMETRY_CHECK(gcon_direct, 3, 2); return gcon_direct(loc, j, i, sym4(mu, nu)); }
 KOKKOS_INLINE_FUNCTION Real GRCoordinates::gcov(const Loci loc, const int& j, const int& i, const int mu, const int nu) const
-{ return gcov_direct(loc, j, i, mu, nu); }
+{ GEOMETRY_CHECK(gcov_direct, 3, 2); return gcov_direct(loc, j, i, sym4(mu, nu)); }
 KOKKOS_INLINE_FUNCTION Real GRCoordinates::gdet(const Loci loc, const int& j, const int& i) const
-{ return gdet_direct(loc, j, i); }
+{ GEOMETRY_CHECK(gdet_direct, 2, 1); return gdet_direct(loc, j, i); }
 KOKKOS_INLINE_FUNCTION Real GRCoordinates::conn(const int& j, const int& i, const int mu, const int nu, const int lam) const
-{ return conn_direct(j, i, mu, nu, lam); }
+{ GEOMETRY_CHECK(conn_direct, 4, 3); return conn_direct(j, i, mu, sym4(nu, lam)); }
 KOKKOS_INLINE_FUNCTION Real GRCoordinates::gdet_conn(const int& j, const int& i, const int mu, const int nu, const int lam) const
-{ return gdet_conn_direct(j, i, mu, nu, lam); }
+{ GEOMETRY_CHECK(gdet_conn_direct, 4, 3); return gdet_conn_direct(j, i, mu, sym4(nu, lam)); }
 
 KOKKOS_INLINE_FUNCTION void GRCoordinates::gcon(const Loci loc, const int& j, const int& i, Real gcon[GR_DIM][GR_DIM]) const
-{ DLOOP2 gcon[mu][nu] = gcon_direct(loc, j, i, mu, nu); }
+{ GEOMETRY_CHECK(gcon_direct, 3, 2); DLOOP2 gcon[mu][nu] = gcon_direct(loc, j, i, sym4(mu, nu)); }
 KOKKOS_INLINE_FUNCTION void GRCoordinates::gcov(const Loci loc, const int& j, const int& i, Real gcov[GR_DIM][GR_DIM]) const
-{ DLOOP2 gcov[mu][nu] = gcov_direct(loc, j, i, mu, nu); }
+{ GEOMETRY_CHECK(gcov_direct, 3, 2); DLOOP2 gcov[mu][nu] = gcov_direct(loc, j, i, sym4(mu, nu)); }
 KOKKOS_INLINE_FUNCTION void GRCoordinates::conn(const int& j, const int& i, Real conn[GR_DIM][GR_DIM][GR_DIM]) const
-{ DLOOP3 conn[mu][nu][lam] = conn_direct(j, i, mu, nu, lam); }
+{ GEOMETRY_CHECK(conn_direct, 4, 3); DLOOP3 conn[mu][nu][lam] = conn_direct(j, i, mu, sym4(nu, lam)); }
 KOKKOS_INLINE_FUNCTION void GRCoordinates::gdet_conn(const int& j, const int& i, Real gdet_conn[GR_DIM][GR_DIM][GR_DIM]) const
-{ DLOOP3 gdet_conn[mu][nu][lam] = gdet_conn_direct(j, i, mu, nu, lam); }
+{ GEOMETRY_CHECK(gdet_conn_direct, 4, 3); DLOOP3 gdet_conn[mu][nu][lam] = gdet_conn_direct(j, i, mu, sym4(nu, lam)); }
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::lapse(const Loci loc, const int& j, const int& i) const
+{ GEOMETRY_CHECK(adm_direct, 2, 1); return adm_direct(adm_alpha, loc, j, i); }
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::shift(const Loci loc, const int& j, const int& i, const int mu) const
+{ GEOMETRY_CHECK(adm_direct, 2, 1); return adm_direct(adm_alpha + mu, loc, j, i); }
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::gamma_cov(const Loci loc, const int& j, const int& i, const int mu, const int nu) const
+{ GEOMETRY_CHECK(adm_direct, 2, 1); return adm_direct(adm_gcov11 + sym3(mu, nu), loc, j, i); }
+KOKKOS_INLINE_FUNCTION Real GRCoordinates::gamma_con(const Loci loc, const int& j, const int& i, const int mu, const int nu) const
+{ GEOMETRY_CHECK(adm_direct, 2, 1); return adm_direct(adm_gcon11 + sym3(mu, nu), loc, j, i); }
+#undef GEOMETRY_CHECK
 
 #endif
 
@@ -366,22 +518,31 @@ KOKKOS_INLINE_FUNCTION void GRCoordinates::coord_embed(const int& k, const int&
     coords.coord_to_embed(Xnative, Xembed);
 }
 
-// These are basically just call-throughs with coord()
-// TODO should we cache, esp for e.g. floors?
+// These are basically just call-throughs with coord(), except r/th/phi in spherical systems,
+// which are used by floors, sources etc. and are cached in order to skip the coordinate transform
 KOKKOS_INLINE_FUNCTION GReal GRCoordinates::r(const int& k, const int& j, const int& i, const Loci& loc) const
 {
+#if !NO_CACHE
+    if (sph_cached) return r_direct(loc, i);
+#endif
     GReal Xnative[GR_DIM];
     coord(k, j, i, loc, Xnative);
     return coords.r_of(Xnative);
 }
 KOKKOS_INLINE_FUNCTION GReal GRCoordinates::th(const int& k, const int& j, const int& i, const Loci& loc) const
 {
+#if !NO_CACHE
+    if (sph_cached) return th_direct(loc, j, i);
+#endif
     GReal Xnative[GR_DIM];
     coord(k, j, i, loc, Xnative);
     return coords.th_of(Xnative);
 }
 KOKKOS_INLINE_FUNCTION GReal GRCoordinates::phi(const int& k, const int& j, const int& i, const Loci& loc) const
 {
+#if !NO_CACHE
+    if (sph_cached) return phi_direct(loc, k);
+#endif
     GReal Xnative[GR_DIM];
     coord(k, j, i, loc, Xnative);
     return coords.phi_of(Xnative);
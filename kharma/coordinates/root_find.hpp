@@ -35,87 +35,41 @@
 
 #include "decs.hpp"
 
-#define ROOTFIND_TOL 1.e-9
+#define ROOTFIND_TOL 1.e-12
+#define ROOTFIND_MAX_ITER 100
 
 /**
- * Root finder macro for X[2] since it is sometimes not analytically invertible
- * Written with a common interface for doing 2D solves, if those are ever required
- * 
- * TODO ASSUMES Xnative bounds are [0,1] and Xembed bounds are [0,M_PI]!!!!!
- * TODO I cannot find a remotely simple way to do this with templates or function pointers:
- *      if this is taken out of the enclosing scope we need to resolve coord_to_embed, which is haaaard
- * 
- * Takes names Xembed (filled, not modified), Xnative (filled, modifies X[2]), and calls function coord_to_embed
+ * Root finder for X[2] since it is sometimes not analytically invertible.
+ * Newton's method with the transform's own dxdX, safeguarded by bisection whenever a step would leave
+ * the bracket, e.g. where th is flat from excision at the poles.  Converges in a handful of iterations,
+ * vs. the ~30 of plain bisection.
+ *
+ * ASSUMES Xnative bounds are [0,1] and Xembed bounds are [0,M_PI], with th increasing in X[2]!
+ *
+ * Xnative[1] and Xnative[3] must already be set, as th may also depend on X[1].  Returns X[2]
  */
-#define ROOT_FIND \
-    double th = Xembed[2];\
-    double tha, thb, thc;\
-\
-    double Xa[GR_DIM], Xb[GR_DIM], Xc[GR_DIM], Xtmp[GR_DIM];\
-    Xa[1] = Xnative[1];\
-    Xa[3] = Xnative[3];\
-\
-    Xb[1] = Xa[1];\
-    Xb[3] = Xa[3];\
-    Xc[1] = Xa[1];\
-    Xc[3] = Xa[3];\
-\
-    if (Xembed[2] < M_PI / 2.) {\
-        Xa[2] = 0.;\
-        Xb[2] = 0.5 + SMALL;\
-    } else {\
-        Xa[2] = 0.5 - SMALL;\
-        Xb[2] = 1.;\
-    }\
-\
-    coord_to_embed(Xa, Xtmp); tha = Xtmp[2];\
-    coord_to_embed(Xb, Xtmp); thb = Xtmp[2];\
-\
-    if (m::abs(tha-th) < ROOTFIND_TOL) {\
-        Xnative[2] = Xa[2]; return;\
-    } else if (m::abs(thb-th) < ROOTFIND_TOL) {\
-        Xnative[2] = Xb[2]; return;\
-    }\
-    for (int i = 0; i < 1000; i++) {\
-        Xc[2] = 0.5 * (Xa[2] + Xb[2]);\
-        coord_to_embed(Xc, Xtmp); thc = Xtmp[2];\
-\
-        if (m::abs(thc - th) < ROOTFIND_TOL) break;\
-        else if ((thc - th) * (thb - th) < 0.) Xa[2] = Xc[2];\
-        else Xb[2] = Xc[2];\
-    }\
-    Xnative[2] = Xc[2];
+template<typename Transform>
+KOKKOS_INLINE_FUNCTION GReal root_find_x2(const Transform& transform, const GReal Xembed[GR_DIM], const GReal Xnative[GR_DIM])
+{
+    const GReal th = Xembed[2];
+    GReal X[GR_DIM] = {Xnative[0], Xnative[1], 0., Xnative[3]};
+    GReal Xtmp[GR_DIM], J[GR_DIM][GR_DIM];
 
-#define ROOT_FIND_1 \
-    double r = Xembed[1];\
-    double ra, rb, rc;\
-\
-    double Xa[GR_DIM], Xb[GR_DIM], Xc[GR_DIM], Xtmp[GR_DIM];\
-    Xa[2] = Xnative[2];\
-    Xa[3] = Xnative[3];\
-\
-    Xb[2] = Xa[2];\
-    Xb[3] = Xa[3];\
-    Xc[2] = Xa[2];\
-    Xc[3] = Xa[3];\
-\
-    Xa[1] = 0.;\
-    Xb[1] = 100.;\
-\
-    coord_to_embed(Xa, Xtmp); ra = Xtmp[1];\
-    coord_to_embed(Xb, Xtmp); rb = Xtmp[1];\
-\
-    if (m::abs(ra-r) < ROOTFIND_TOL) {\
-        Xnative[1] = Xa[1]; return;\
-    } else if (m::abs(rb-r) < ROOTFIND_TOL) {\
-        Xnative[1] = Xb[1]; return;\
-    }\
-    for (int i = 0; i < 1000; i++) {\
-        Xc[1] = 0.5 * (Xa[1] + Xb[1]);\
-        coord_to_embed(Xc, Xtmp); rc = Xtmp[1];\
-\
-        if (m::abs(rc - r) < ROOTFIND_TOL) break;\
-        else if ((rc - r) * (rb - r) < 0.) Xa[1] = Xc[1];\
-        else Xb[1] = Xc[1];\
-    }\
-    Xnative[1] = Xc[1];
+    // Bracket, and a first guess linear in th
+    GReal xa = 0., xb = 1.;
+    X[2] = m::min(m::max(th / M_PI, 0.), 1.);
+    for (int iter = 0; iter < ROOTFIND_MAX_ITER; iter++) {
+        transform.coord_to_embed(X, Xtmp);
+        const GReal err = Xtmp[2] - th;
+        if (m::abs(err) < ROOTFIND_TOL) break;
+        if (err > 0.) xb = X[2];
+        else xa = X[2];
+
+        transform.dxdX(X, J);
+        GReal next = X[2] - err / J[2][2];
+        // This also catches NaN steps
+        if (!(next > xa && next < xb)) next = 0.5 * (xa + xb);
+        X[2] = next;
+    }
+    return X[2];
+}
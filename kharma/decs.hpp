@@ -91,6 +91,15 @@ using GReal = double;
 #define DLOOP2 DLOOP1 for(int nu = 0; nu < GR_DIM; ++nu)
 #define DLOOP3 DLOOP2 for(int lam = 0; lam < GR_DIM; ++lam)
 #define DLOOP4 DLOOP3 for(int kap = 0; kap < GR_DIM; ++kap)
+// Index of component (mu, nu), with mu,nu in 0..3, of a symmetric 4x4 tensor stored as its upper triangle.
+// The metric, and the lower indices of the connection, are cached in this form: 10 rather than 16 components
+#define GR_SYM 10
+KOKKOS_FORCEINLINE_FUNCTION int sym4(const int& mu, const int& nu)
+{
+    const int lo = (mu < nu) ? mu : nu;
+    const int hi = (mu < nu) ? nu : mu;
+    return lo*4 - (lo*(lo-1))/2 + (hi - lo);
+}
 
 #define NVEC 3
 #define VLOOP for(int v = 0; v < NVEC; ++v)
@@ -38,6 +38,11 @@
 
 #include "boundaries.hpp"
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
 namespace KDomain {
 
 /**
@@ -186,6 +191,168 @@ inline IndexRange3 GetPhysicalRange(MeshBlockData<T>* rc)
                                     : (uint) bounds.ke(IndexDomain::entire)};
 }
 
+/**
+ * Host-side data kept for each MeshData partition between tasks, e.g. cached ranges or lists handed
+ * from one task to a later one in the same cycle.  Partitions are identified by their first block
+ * & number of blocks, so that data stored from one MeshData object can be read back from another over
+ * the same blocks (e.g. the solver & stage data).
+ *
+ * Task lists over different partitions may run concurrently, so lookups & insertions are locked.
+ * A returned reference belongs to the tasks over that partition, and stays valid as long as the mesh is
+ * partitioned the same way: entries are only erased when a new partition overlapping them is first used,
+ * e.g. after remeshing.  Copies share the same entries & lock, so this can be stored in Params.
+ */
+template<typename V>
+class PartitionStore {
+    public:
+        // The entry for 'md', default-constructed if it doesn't exist yet
+        template<typename T>
+        V& Get(MeshData<T>* md)
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            const auto key = Key(md);
+            auto found = state->entries.find(key);
+            if (found != state->entries.end()) return found->second;
+            // New partition: drop anything kept for old ones over the same blocks
+            for (auto it = state->entries.begin(); it != state->entries.end();) {
+                const bool overlaps = it->first.first < key.first + key.second &&
+                                      key.first < it->first.first + it->first.second;
+                it = (overlaps) ? state->entries.erase(it) : std::next(it);
+            }
+            return state->entries[key];
+        }
+        // The entry for 'md' if it exists, otherwise nullptr
+        template<typename T>
+        V* Find(MeshData<T>* md)
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            auto it = state->entries.find(Key(md));
+            return (it == state->entries.end()) ? nullptr : &(it->second);
+        }
+        // Call f on every entry, with no other access in between
+        template<typename Function>
+        void ForEach(Function f)
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            for (auto& entry : state->entries) f(entry.second);
+        }
+
+    private:
+        template<typename T>
+        static std::pair<int, int> Key(MeshData<T>* md)
+        {
+            return {md->GetBlockData(0)->GetBlockPointer()->gid, md->NumBlocks()};
+        }
+        struct State {
+            std::mutex mutex;
+            std::map<std::pair<int, int>, V> entries;
+        };
+        std::shared_ptr<State> state = std::make_shared<State>();
+};
+
+/**
+ * Physical ranges of every block in a MeshData object, as above, on device for use in pack-wide kernels.
+ * 'ranges' is only reallocated if it is too small, so callers can keep it around between calls
+ */
+template<typename T>
+inline void GetPhysicalRanges(MeshData<T>* md, Kokkos::View<IndexRange3*>& ranges)
+{
+    const int nblocks = md->NumBlocks();
+    if (ranges.extent_int(0) < nblocks)
+        ranges = Kokkos::View<IndexRange3*>("physical_ranges", nblocks);
+    auto ranges_h = Kokkos::create_mirror_view(ranges);
+    for (int b = 0; b < nblocks; ++b)
+        ranges_h(b) = GetPhysicalRange(md->GetBlockData(b).get());
+    Kokkos::deep_copy(ranges, ranges_h);
+}
+// Cached physical ranges for each partition
+using PhysicalRanges = PartitionStore<Kokkos::View<IndexRange3*>>;
+
+/**
+ * Compacted list of zones (b, k, j, i) in a MeshData object, for revisiting the few zones which need it
+ * after a full pass (e.g. solver failures) without sweeping the whole mesh again.
+ *
+ * Zones are appended from device with Add().  The list holds at most Capacity() zones: if Size()
+ * comes back larger, zones were dropped, and callers should fall back to a full sweep and Reserve() more.
+ */
+class ZoneList {
+    public:
+        Kokkos::View<int*[4]> zones;
+        Kokkos::View<int> count;
+        // Host-side: cycle in which the list was started, or -1 if it is not current.  See StartZoneList
+        int cycle = -1;
+
+        // Make room for at least n zones, and empty the list
+        void Reset(const int n)
+        {
+            if (zones.extent_int(0) < n)
+                zones = Kokkos::View<int*[4]>("zone_list", n);
+            if (!count.is_allocated())
+                count = Kokkos::View<int>("zone_list_count");
+            Kokkos::deep_copy(count, 0);
+        }
+        int Capacity() const { return zones.extent_int(0); }
+        // Number of zones added since the last Reset.  Synchronizes with the device
+        int Size() const
+        {
+            int n;
+            Kokkos::deep_copy(n, count);
+            return n;
+        }
+
+        KOKKOS_INLINE_FUNCTION void Add(const int& b, const int& k, const int& j, const int& i) const
+        {
+            const int n = Kokkos::atomic_fetch_add(&count(), 1);
+            if (n < zones.extent_int(0)) {
+                zones(n, 0) = b;
+                zones(n, 1) = k;
+                zones(n, 2) = j;
+                zones(n, 3) = i;
+            }
+        }
+};
+
+/**
+ * Lists of zones handed from one task to a later one in the same cycle, e.g. failed inversions to the fixup.
+ * One per partition, see PartitionStore
+ */
+using ZoneLists = PartitionStore<ZoneList>;
+
+/**
+ * Empty the list for 'md' and mark it current for this cycle
+ */
+template<typename T>
+inline ZoneList StartZoneList(ZoneLists& lists, MeshData<T>* md, const int& min_size=1024)
+{
+    auto& list = lists.Get(md);
+    list.Reset(min_size);
+    list.cycle = md->GetMeshPointer()->ncycle;
+    return list;
+}
+
+/**
+ * The list for 'md' if one was started this cycle, otherwise nullptr
+ */
+template<typename T>
+inline ZoneList* FindZoneList(ZoneLists& lists, MeshData<T>* md)
+{
+    ZoneList* list = lists.Find(md);
+    if (list == nullptr || list->cycle != md->GetMeshPointer()->ncycle)
+        return nullptr;
+    return list;
+}
+
+/**
+ * As FindZoneList, but marks the list as used, so it won't be found again
+ */
+template<typename T>
+inline ZoneList* TakeZoneList(ZoneLists& lists, MeshData<T>* md)
+{
+    ZoneList* list = FindZoneList(lists, md);
+    if (list != nullptr) list->cycle = -1;
+    return list;
+}
+
 template<typename T>
 inline IndexSize3 GetBlockSize(T data, IndexDomain domain=IndexDomain::entire)
 {
@@ -266,6 +266,11 @@ TaskID KHARMADriver::AddFluxCalculations(TaskID& t_start, TaskList& tl, MeshData
         t_calculate_flux2 = tl.AddTask(t_start_fluxes, Flux::GetFlux<RType::mp5, X2DIR>, md);
         t_calculate_flux3 = tl.AddTask(t_start_fluxes, Flux::GetFlux<RType::mp5, X3DIR>, md);
         break;
+    case RType::hybrid:
+        t_calculate_flux1 = tl.AddTask(t_start_fluxes, Flux::GetFlux<RType::hybrid, X1DIR>, md);
+        t_calculate_flux2 = tl.AddTask(t_start_fluxes, Flux::GetFlux<RType::hybrid, X2DIR>, md);
+        t_calculate_flux3 = tl.AddTask(t_start_fluxes, Flux::GetFlux<RType::hybrid, X3DIR>, md);
+        break;
     default:
         std::cerr << "Reconstruction type not supported!  Main supported reconstructions:" << std::endl
                   << "donor_cell, linear_mc, weno5" << std::endl;
@@ -377,6 +382,47 @@ TaskID KHARMADriver::AddStateUpdate(TaskID& t_start, TaskList& tl, MeshData<Real
     return t_copy_prims | t_update;
 }
 
+TaskID KHARMADriver::AddFusedStateUpdate(TaskID& t_start, TaskList& tl, MeshData<Real> *md_full_step_init, MeshData<Real> *md_sub_step_init,
+                                         MeshData<Real> *md_flux_src, MeshData<Real> *md_update, std::vector<MetadataFlag> flags,
+                                         bool update_face, int stage)
+{
+    // Cell-centered variables: -divF + S and the RK update at once.  Only variables with fluxes can be included
+    std::vector<MetadataFlag> flags_cell = flags; flags_cell.push_back(Metadata::Cell); flags_cell.push_back(Metadata::WithFluxes);
+    auto t_update = tl.AddTask(t_start, Flux::FusedUpdate, md_full_step_init, md_sub_step_init, md_update,
+                                std::vector<MetadataFlag>(flags_cell),
+                                integrator->gam0[stage-1], integrator->gam1[stage-1],
+                                integrator->beta[stage-1] * integrator->dt);
+
+    // Face-centered variables as in AddStateUpdate.  With a fused update the only face source is from B_CT
+    if (update_face) {
+        std::vector<MetadataFlag> flags_face = flags; flags_face.push_back(Metadata::Face);
+        auto t_face_source = tl.AddTask(t_start, B_CT::AddSource, md_sub_step_init, md_flux_src, IndexDomain::interior);
+        auto t_avg_face = tl.AddTask(t_start, WeightedSumDataFace,
+                                    std::vector<MetadataFlag>(flags_face),
+                                    md_sub_step_init, md_full_step_init,
+                                    integrator->gam0[stage-1], integrator->gam1[stage-1],
+                                    md_update);
+        auto t_update_face = tl.AddTask(t_face_source | t_avg_face, WeightedSumDataFace,
+                                    std::vector<MetadataFlag>(flags_face),
+                                    md_update, md_flux_src,
+                                    1.0, integrator->beta[stage-1] * integrator->dt,
+                                    md_update);
+        t_update = t_update | t_update_face;
+    }
+
+    // Guess for UtoP, as in AddStateUpdate
+    auto t_copy_prims = t_update;
+    auto pmb0  = md_full_step_init->GetBlockData(0)->GetBlockPointer();
+    auto& pkgs = pmb0->packages.AllPackages();
+    if (!pkgs.at("GRMHD")->Param<bool>("implicit")) {
+        t_copy_prims = tl.AddTask(t_start, Copy<MeshData<Real>>,
+                                    std::vector<MetadataFlag>({Metadata::GetUserFlag("HD"), Metadata::GetUserFlag("Primitive")}),
+                                    md_sub_step_init, md_update);
+    }
+
+    return t_copy_prims | t_update;
+}
+
 void KHARMADriver::SetGlobalTimeStep()
 {
   // TODO(BSP) apply the limits from GRMHD package here
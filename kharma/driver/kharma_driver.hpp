@@ -132,6 +132,14 @@ class KHARMADriver : public MultiStageDriver {
         TaskID AddStateUpdate(TaskID& t_start, TaskList& tl, MeshData<Real> *md_full_step_init, MeshData<Real> *md_sub_step_init,
                                 MeshData<Real> *md_flux_src, MeshData<Real> *md_update, std::vector<MetadataFlag> flags,
                                 bool update_face, int stage);
+        /**
+         * As AddStateUpdate, but computing the flux divergence and geometric source term of cell-centered variables
+         * as part of the update, see Flux::FusedUpdate.  Only face-centered variables go through md_flux_src.
+         * Used with driver/fused_update, which requires that the only other source is B_CT's face update.
+         */
+        TaskID AddFusedStateUpdate(TaskID& t_start, TaskList& tl, MeshData<Real> *md_full_step_init, MeshData<Real> *md_sub_step_init,
+                                MeshData<Real> *md_flux_src, MeshData<Real> *md_update, std::vector<MetadataFlag> flags,
+                                bool update_face, int stage);
 
         /**
          * Add a synchronization retion to an existing TaskCollection tc.
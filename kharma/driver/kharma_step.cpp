@@ -92,6 +92,8 @@ TaskCollection KHARMADriver::MakeDefaultTaskCollection(BlockList_t &blocks, int
     const bool use_b_ct = pkgs.count("B_CT");
     const bool use_electrons = pkgs.count("Electrons");
     const bool use_fofc = flux_pkg.Get<bool>("use_fofc");
+    const bool fused_update = flux_pkg.Get<bool>("fused_update");
+    const bool fused_utop = flux_pkg.Get<bool>("fused_utop");
     const bool use_jcon = pkgs.count("Current");
 
     // Allocate/copy the things we need
@@ -186,18 +188,28 @@ TaskCollection KHARMADriver::MakeDefaultTaskCollection(BlockList_t &blocks, int
             t_flux_bounds = tl.AddTask(t_recv_flux, parthenon::SetFluxCorrections, md_sub_step_init);
         }
 
-        // Apply the fluxes to calculate a change in cell-centered values "md_flux_src"
-        auto t_flux_div = tl.AddTask(t_flux_bounds, FluxDivergence, md_sub_step_init.get(), md_flux_src.get(),
-                                     std::vector<MetadataFlag>{Metadata::Independent, Metadata::Cell, Metadata::WithFluxes}, 0);
-
-        // Add any source terms: geometric \Gamma * T, wind, damping, etc etc
-        // Also where CT sets the change in face fields
-        auto t_sources = tl.AddTask(t_flux_div, Packages::AddSource, md_sub_step_init.get(), md_flux_src.get(), IndexDomain::interior);
-
-        auto t_update = KHARMADriver::AddStateUpdate(t_sources, tl, md_full_step_init.get(), md_sub_step_init.get(),
-                                                  md_flux_src.get(), md_sub_step_final.get(),
-                                                  std::vector<MetadataFlag>{Metadata::GetUserFlag("Explicit"), Metadata::Independent},
-                                                  use_b_ct, stage);
+        TaskID t_update;
+        if (fused_update) {
+            // Apply the fluxes, geometric source term and update in one pass, without filling "md_flux_src"
+            // for cell-centered variables
+            t_update = KHARMADriver::AddFusedStateUpdate(t_flux_bounds, tl, md_full_step_init.get(), md_sub_step_init.get(),
+                                                         md_flux_src.get(), md_sub_step_final.get(),
+                                                         std::vector<MetadataFlag>{Metadata::GetUserFlag("Explicit"), Metadata::Independent},
+                                                         use_b_ct, stage);
+        } else {
+            // Apply the fluxes to calculate a change in cell-centered values "md_flux_src"
+            auto t_flux_div = tl.AddTask(t_flux_bounds, FluxDivergence, md_sub_step_init.get(), md_flux_src.get(),
+                                         std::vector<MetadataFlag>{Metadata::Independent, Metadata::Cell, Metadata::WithFluxes}, 0);
+
+            // Add any source terms: geometric \Gamma * T, wind, damping, etc etc
+            // Also where CT sets the change in face fields
+            auto t_sources = tl.AddTask(t_flux_div, Packages::AddSource, md_sub_step_init.get(), md_flux_src.get(), IndexDomain::interior);
+
+            t_update = KHARMADriver::AddStateUpdate(t_sources, tl, md_full_step_init.get(), md_sub_step_init.get(),
+                                                    md_flux_src.get(), md_sub_step_final.get(),
+                                                    std::vector<MetadataFlag>{Metadata::GetUserFlag("Explicit"), Metadata::Independent},
+                                                    use_b_ct, stage);
+        }
 
         KHARMADriver::AddBoundarySync(t_update, tl, md_sync);
     }
@@ -223,9 +235,15 @@ TaskCollection KHARMADriver::MakeDefaultTaskCollection(BlockList_t &blocks, int
         // This relies on the primitives being calculated identically in MPI boundaries, vs their corresponding
         // physical zones in the adjacent mesh block.  To ensure this, we seed the solver with the same values
         // in each case, by synchronizing them along with the conserved values above.
-        auto t_utop = tl.AddTask(t_none, Packages::MeshUtoP, md_sub_step_final.get(), IndexDomain::entire, false);
-        // As soon as we have primitive variables, apply floors
-        auto t_floors = tl.AddTask(t_utop, Packages::MeshApplyFloors, md_sub_step_final.get(), IndexDomain::entire);
+        TaskID t_floors;
+        if (fused_utop) {
+            // Apply floors to each zone as soon as its primitive variables are recovered
+            t_floors = tl.AddTask(t_none, Packages::MeshUtoPAndFloors, md_sub_step_final.get(), IndexDomain::entire);
+        } else {
+            auto t_utop = tl.AddTask(t_none, Packages::MeshUtoP, md_sub_step_final.get(), IndexDomain::entire, false);
+            // As soon as we have primitive variables, apply floors
+            t_floors = tl.AddTask(t_utop, Packages::MeshApplyFloors, md_sub_step_final.get(), IndexDomain::entire);
+        }
 
         // Then, fix any inversions which failed. Fixups average the adjacent zones, so we want to work from
         // post-floor data. Floors are re-applied after fixups.
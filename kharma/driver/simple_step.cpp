@@ -128,20 +128,26 @@ TaskCollection KHARMADriver::MakeSimpleTaskCollection(BlockList_t &blocks, int s
         KHARMADriver::AddBoundarySync(t_floors, tl, md_sub_step_final);
     }
 
-    // Async Region: Any post-sync tasks.  Fixups, timestep & AMR tagging.
+    // Fix Region: we need to fix UtoP variable inversion failures.
+    // Syncing bounds before calling this, and then running it over the whole domain, will make
+    // behavior for different mesh breakdowns much more similar (identical?), since bad zones in
+    // relevant ghost zone ranks will get to use all the same neighbors as if they were in the bulk.
+    // Run over the same MeshData as MeshUtoP above, so that it consumes the list of failed zones MeshUtoP left
+    TaskRegion &fix_region = tc.AddRegion(num_partitions);
+    for (int i = 0; i < num_partitions; i++) {
+        auto &tl = fix_region[i];
+        auto &md_sub_step_final = pmesh->mesh_data.GetOrAdd(integrator->stage_name[stage], i);
+        tl.AddTask(t_none, Inverter::MeshFixUtoP, md_sub_step_final.get());
+    }
+
+    // Async Region: Any post-sync tasks.  Boundaries, timestep & AMR tagging.
     TaskRegion &async_region2 = tc.AddRegion(blocks.size());
     for (int i = 0; i < blocks.size(); i++) {
         auto &pmb = blocks[i];
         auto &tl  = async_region2[i];
         auto &mbd_sub_step_final = pmb->meshblock_data.Get(integrator->stage_name[stage]);
 
-        // If we're evolving the GRMHD variables explicitly, we need to fix UtoP variable inversion failures
-        // Syncing bounds before calling this, and then running it over the whole domain, will make
-        // behavior for different mesh breakdowns much more similar (identical?), since bad zones in
-        // relevant ghost zone ranks will get to use all the same neighbors as if they were in the bulk
-        auto t_fix_p = tl.AddTask(t_none, Inverter::FixUtoP, mbd_sub_step_final.get());
-
-        auto t_set_bc = tl.AddTask(t_fix_p, parthenon::ApplyBoundaryConditions, mbd_sub_step_final);
+        auto t_set_bc = tl.AddTask(t_none, parthenon::ApplyBoundaryConditions, mbd_sub_step_final);
 
         // Make sure *all* conserved vars are synchronized at step end
         auto t_ptou = tl.AddTask(t_set_bc, Flux::BlockPtoU, mbd_sub_step_final.get(), IndexDomain::entire, false);
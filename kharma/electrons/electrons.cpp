@@ -196,6 +196,7 @@ std::shared_ptr<KHARMAPackage> Initialize(ParameterInput *pin, std::shared_ptr<P
         pkg->AddField("alfven_speed", m);
     }
 
+    pkg->MeshUtoP = Electrons::MeshUtoP;
     pkg->BlockUtoP = Electrons::BlockUtoP;
     pkg->BoundaryUtoP = Electrons::BlockUtoP;
 
@@ -244,6 +245,24 @@ TaskStatus InitElectrons(std::shared_ptr<MeshBlockData<Real>>& rc, ParameterInpu
     return TaskStatus::complete;
 }
 
+void MeshUtoP(MeshData<Real> *md, IndexDomain domain, bool coarse)
+{
+    auto pmb0 = md->GetBlockData(0)->GetBlockPointer();
+
+    auto e_P = md->PackVariables(std::vector<MetadataFlag>{Metadata::GetUserFlag("Elec"), Metadata::GetUserFlag("Primitive")});
+    auto e_U = md->PackVariables(std::vector<MetadataFlag>{Metadata::GetUserFlag("Elec"), Metadata::Conserved});
+    auto rho_U = md->PackVariables(std::vector<std::string>{"cons.rho"});
+    if (e_P.GetDim(4) == 0) return;
+
+    const IndexRange3 b = KDomain::GetRange(md, domain, coarse);
+    const IndexRange block = IndexRange{0, e_P.GetDim(5) - 1};
+    pmb0->par_for("UtoP_electrons", block.s, block.e, 0, e_P.GetDim(4)-1, b.ks, b.ke, b.js, b.je, b.is, b.ie,
+        KOKKOS_LAMBDA (const int &bl, const int &p, const int &k, const int &j, const int &i) {
+            e_P(bl, p, k, j, i) = e_U(bl, p, k, j, i) / rho_U(bl, 0, k, j, i);
+        }
+    );
+}
+
 void BlockUtoP(MeshBlockData<Real> *rc, IndexDomain domain, bool coarse)
 {
     auto pmb = rc->GetBlockPointer();
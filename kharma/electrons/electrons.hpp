@@ -84,6 +84,10 @@ TaskStatus InitElectrons(std::shared_ptr<MeshBlockData<Real>>& rc, ParameterInpu
  * Function in this package: Get the specific entropy primitive value, by dividing the total entropy K/(rho*u^0)
  */
 void BlockUtoP(MeshBlockData<Real> *rc, IndexDomain domain, bool coarse=false);
+/**
+ * As BlockUtoP, for all blocks of 'md' in one kernel
+ */
+void MeshUtoP(MeshData<Real> *md, IndexDomain domain, bool coarse=false);
 
 /**
  * This heating step is custom for this package.  It is added manually to any task list in the KHARMADriver,
@@ -193,7 +193,7 @@ void MeshUtoP(MeshData<Real> *md, IndexDomain domain, bool coarse)
     auto P   = md->PackVariables(std::vector<MetadataFlag>{Metadata::GetUserFlag("Primitive")}, prims_map);
     const VarMap m_p(prims_map, false), m_u(cons_map, true);
 
-    const auto& G = pmb->coords;
+    if (U_E.GetDim(4) == 0) return;
 
     auto bounds      = coarse ? pmb->c_cellbounds : pmb->cellbounds;
     IndexRange ib    = bounds.GetBoundsI(domain);
@@ -202,7 +202,8 @@ void MeshUtoP(MeshData<Real> *md, IndexDomain domain, bool coarse)
     IndexRange block = IndexRange{0, U_E.GetDim(5)-1};
 
     pmb->par_for("UtoP_EMHD", block.s, block.e, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
-        KOKKOS_LAMBDA (const int& b, const int &k, const int &j, const int &i) { 
+        KOKKOS_LAMBDA (const int& b, const int &k, const int &j, const int &i) {
+            const auto& G        = U_E.GetCoords(b);
             const Real gamma     = GRMHD::lorentz_calc(G, P(b), m_p, k, j, i, Loci::center);
             const Real inv_alpha = m::sqrt(-G.gcon(Loci::center, j, i, 0, 0));
             const Real ucon0     = gamma * inv_alpha;
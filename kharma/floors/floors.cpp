@@ -238,6 +238,40 @@ TaskStatus Floors::ApplyGRMHDFloors(MeshData<Real> *md, IndexDomain domain)
     }
 }
 
+template<Inverter::Type inverter>
+TaskStatus UtoPAndFloors(MeshData<Real> *md, IndexDomain domain, InjectionFrame frame)
+{
+    if (frame == InjectionFrame::normal) {
+        return Floors::UtoPAndFloorsInFrame<inverter, InjectionFrame::normal>(md, domain);
+    } else if (frame == InjectionFrame::fluid) {
+        return Floors::UtoPAndFloorsInFrame<inverter, InjectionFrame::fluid>(md, domain);
+    } else if (frame == InjectionFrame::mixed_fluid_normal) {
+        return Floors::UtoPAndFloorsInFrame<inverter, InjectionFrame::mixed_fluid_normal>(md, domain);
+    } else if (frame == InjectionFrame::mixed_fluid_drift) {
+        return Floors::UtoPAndFloorsInFrame<inverter, InjectionFrame::mixed_fluid_drift>(md, domain);
+    } else if (frame == InjectionFrame::drift) {
+        return Floors::UtoPAndFloorsInFrame<inverter, InjectionFrame::drift>(md, domain);
+    } else {
+        throw std::invalid_argument("Floors for requested frame not implemented!");
+    }
+}
+
+TaskStatus Floors::MeshUtoPAndFloors(MeshData<Real> *md, IndexDomain domain)
+{
+    auto pmesh = md->GetMeshPointer();
+    const InjectionFrame frame = pmesh->packages.Get("Floors")->Param<InjectionFrame>("frame");
+    auto& type = pmesh->packages.Get("Inverter")->Param<Inverter::Type>("inverter_type");
+    switch(type) {
+    case Inverter::Type::onedw:
+        return UtoPAndFloors<Inverter::Type::onedw>(md, domain, frame);
+    case Inverter::Type::kastaun:
+        return UtoPAndFloors<Inverter::Type::kastaun>(md, domain, frame);
+    case Inverter::Type::none:
+        break;
+    }
+    return ApplyGRMHDFloors(md, domain);
+}
+
 TaskStatus Floors::PostStepDiagnostics(const SimTime& tm, MeshData<Real> *md)
 {
     auto pmesh = md->GetMeshPointer();
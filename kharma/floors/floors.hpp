@@ -175,6 +175,16 @@ std::shared_ptr<KHARMAPackage> Initialize(ParameterInput *pin, std::shared_ptr<P
  */
 TaskStatus ApplyGRMHDFloors(MeshData<Real> *md, IndexDomain domain);
 
+/**
+ * Recover the fluid primitives as Inverter::MeshUtoP, then determine & apply floors and ceilings
+ * as ApplyGRMHDFloors, all in one kernel.  Used with driver/fused_utop.
+ * Expects the primitive B field to be filled already.  Failed inversions are still left
+ * for Inverter::MeshFixUtoP.
+ *
+ * LOCKSTEP: this function expects U and returns consistent P<->U
+ */
+TaskStatus MeshUtoPAndFloors(MeshData<Real> *md, IndexDomain domain);
+
 /**
  * Determine just the floor values and flags for the current state, i.e.
  * 1. floor_vals fields: floor value corresponding to current conditions
@@ -36,6 +36,7 @@
 #include "floors.hpp"
 
 #include "domain.hpp"
+#include "inverter.hpp"
 
 namespace Floors {
 
@@ -67,6 +68,14 @@ TaskStatus ApplyFloorsInFrame(MeshData<Real> *md, IndexDomain domain)
     // Determine floors
     DetermineGRMHDFloors(md, domain, floors);
 
+    // If MeshUtoP is keeping a list of failed zones for the fixup, add any new interior failures
+    KDomain::ZoneList* fail_list_cache = (pmb0->packages.AllPackages().count("Inverter")) ?
+        KDomain::FindZoneList(*pmb0->packages.Get("Inverter")->AllParams().GetMutable<KDomain::ZoneLists>("fail_lists"), md)
+        : nullptr;
+    const bool record_fails = fail_list_cache != nullptr;
+    const auto fail_list = (record_fails) ? *fail_list_cache : KDomain::ZoneList();
+    const IndexRange3 bi = KDomain::GetRange(md, IndexDomain::interior);
+
     const IndexRange3 b = KDomain::GetRange(md, domain);
     const IndexRange block = IndexRange{0, P.GetDim(5) - 1};
     pmb0->par_for("apply_floors", block.s, block.e, b.ks, b.ke, b.js, b.je, b.is, b.ie,
@@ -80,7 +89,12 @@ TaskStatus ApplyFloorsInFrame(MeshData<Real> *md, IndexDomain domain)
 
                 // Record the pflag if nonzero, that is, if *either* the initial inversion or
                 // post-floor inversion failed.
-                if (pflag_l) pflag(b, 0, k, j, i) = pflag_l;
+                if (pflag_l) {
+                    if (record_fails && Inverter::failed(pflag_l) && !Inverter::failed(pflag(b, 0, k, j, i))
+                        && KDomain::inside(k, j, i, bi))
+                        fail_list.Add(b, k, j, i);
+                    pflag(b, 0, k, j, i) = pflag_l;
+                }
 
                 // Apply ceilings *after* floors, to make the temperature ceiling better-behaved
                 apply_ceilings(G, P(b), m_p, gam, k, j, i, floors, U(b), m_u);
@@ -94,4 +108,91 @@ TaskStatus ApplyFloorsInFrame(MeshData<Real> *md, IndexDomain domain)
     return TaskStatus::complete;
 }
 
+/**
+ * Fused version of Inverter::MeshUtoP followed by ApplyFloorsInFrame, see MeshUtoPAndFloors.
+ * Each zone is recovered, floored and put back in P<->U lockstep while it is in registers,
+ * rather than reading the whole state again for each step
+ */
+template<Inverter::Type inverter, InjectionFrame frame>
+TaskStatus UtoPAndFloorsInFrame(MeshData<Real> *md, IndexDomain domain)
+{
+    auto pmb0 = md->GetBlockData(0)->GetBlockPointer();
+
+    PackIndexMap prims_map, cons_map;
+    auto P = md->PackVariables(std::vector<MetadataFlag>{Metadata::GetUserFlag("Primitive")}, prims_map);
+    auto U = md->PackVariables(std::vector<MetadataFlag>{Metadata::Conserved}, cons_map);
+    const VarMap m_u(cons_map, true), m_p(prims_map, false);
+
+    auto fflag = md->PackVariables(std::vector<std::string>{"fflag"});
+    auto pflag = md->PackVariables(std::vector<std::string>{"pflag"});
+    auto root = md->PackVariables(std::vector<std::string>{"Inverter.root"});
+    const bool warm_start = root.GetDim(4) > 0;
+    PackIndexMap floors_map;
+    auto floor_vals = md->PackVariables(std::vector<std::string>{"Floors.rho_floor", "Floors.u_floor"}, floors_map);
+    const int rhofi = floors_map["Floors.rho_floor"].first;
+    const int ufi = floors_map["Floors.u_floor"].first;
+
+    const Real gam = pmb0->packages.Get("GRMHD")->Param<Real>("gamma");
+    const EMHD::EMHD_parameters& emhd_params = EMHD::GetEMHDParameters(pmb0->packages);
+    const Floors::Prescription floors = pmb0->packages.Get("Floors")->Param<Floors::Prescription>("prescription");
+
+    auto &pars = pmb0->packages.Get("Inverter")->AllParams();
+    const Real err_tol = pars.Get<Real>("err_tol");
+    const int iter_max = pars.Get<int>("iter_max");
+    const Floors::Prescription inverter_floors = pars.Get<Floors::Prescription>("inverter_prescription");
+
+    // Recover only the physical zones, as MeshPerformInversion, but apply floors over all of 'domain'
+    auto& ranges_cache = pars.GetMutable<KDomain::PhysicalRanges>("physical_ranges")->Get(md);
+    KDomain::GetPhysicalRanges(md, ranges_cache);
+    const auto ranges = ranges_cache;
+
+    // Record interior failures of either the inversion or the floors, for MeshFixUtoP
+    const auto fail_list = KDomain::StartZoneList(*pars.GetMutable<KDomain::ZoneLists>("fail_lists"), md);
+    const IndexRange3 bi = KDomain::GetRange(md, IndexDomain::interior);
+
+    const IndexRange3 b = KDomain::GetRange(md, domain);
+    const IndexRange block = IndexRange{0, P.GetDim(5) - 1};
+    pmb0->par_for("utop_floors", block.s, block.e, b.ks, b.ke, b.js, b.je, b.is, b.ie,
+        KOKKOS_LAMBDA (const int &b, const int &k, const int &j, const int &i) {
+            const auto& G = P.GetCoords(b);
+            const bool interior = KDomain::inside(k, j, i, bi);
+
+            // Recover primitives, hiding any inverter floors in the upper bits of the flag as in MeshPerformInversion
+            if (!KDomain::outside(k, j, i, ranges(b))) {
+                const int pflagl = Inverter::u_to_p<inverter>(G, U(b), m_u, gam, k, j, i, P(b), m_p, Loci::center,
+                                                              inverter_floors, iter_max, err_tol,
+                                                              (warm_start) ? &root(b, 0, k, j, i) : nullptr);
+                pflag(b, 0, k, j, i) = pflagl % Floors::FFlag::MINIMUM;
+                fflag(b, 0, k, j, i) = (pflagl / Floors::FFlag::MINIMUM) * Floors::FFlag::MINIMUM;
+                if (Inverter::failed(pflagl % Floors::FFlag::MINIMUM) && interior)
+                    fail_list.Add(b, k, j, i);
+            }
+
+            // Determine floors, as DetermineGRMHDFloors
+            const int fflagl = static_cast<int>(fflag(b, 0, k, j, i)) |
+                                determine_floors(G, P(b), m_p, gam, k, j, i, floors,
+                                                 floor_vals(b, rhofi, k, j, i), floor_vals(b, ufi, k, j, i));
+            fflag(b, 0, k, j, i) = fflagl;
+
+            // Apply them, as ApplyFloorsInFrame
+            if (fflagl) {
+                int pflag_l = apply_floors<frame>(G, P(b), m_p, gam, k, j, i,
+                                                floor_vals(b, rhofi, k, j, i), floor_vals(b, ufi, k, j, i),
+                                                U(b), m_u);
+                if (pflag_l) {
+                    if (Inverter::failed(pflag_l) && !Inverter::failed(pflag(b, 0, k, j, i)) && interior)
+                        fail_list.Add(b, k, j, i);
+                    pflag(b, 0, k, j, i) = pflag_l;
+                }
+
+                apply_ceilings(G, P(b), m_p, gam, k, j, i, floors, U(b), m_u);
+
+                Flux::p_to_u_mhd(G, P(b), m_p, emhd_params, gam, k, j, i, U(b), m_u, Loci::center);
+            }
+        }
+    );
+
+    return TaskStatus::complete;
+}
+
 } // namespace Floors
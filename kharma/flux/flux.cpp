@@ -36,8 +36,10 @@
 // Most includes are in the header TODO fix?
 
 #include "b_ct.hpp"
+#include "domain.hpp"
 #include "grmhd.hpp"
 #include "kharma.hpp"
+#include "kharma_driver.hpp"
 
 using namespace parthenon;
 
@@ -73,7 +75,7 @@ std::shared_ptr<KHARMAPackage> Flux::Initialize(ParameterInput *pin, std::shared
         default_recon_s = pin->GetString("GRMHD", "reconstruction");
     }
     std::vector<std::string> recon_allowed_vals = {"donor_cell", "donor_cell_c", "linear_vl", "linear_mc",
-                                             "weno5", "weno5_linear", "ppm", "ppmx", "mp5"};
+                                             "weno5", "weno5_linear", "ppm", "ppmx", "mp5", "hybrid"};
     std::string recon = pin->GetOrAddString("flux", "reconstruction", default_recon_s, recon_allowed_vals);
     bool lower_edges = pin->GetOrAddBoolean("flux", "low_order_edges", false);
     bool lower_poles = pin->GetOrAddBoolean("flux", "low_order_poles", false);
@@ -118,6 +120,9 @@ std::shared_ptr<KHARMAPackage> Flux::Initialize(ParameterInput *pin, std::shared
     } else if (recon == "mp5") {
         params.Add("recon", KReconstruction::Type::mp5);
         stencil = 5;
+    } else if (recon == "hybrid") {
+        params.Add("recon", KReconstruction::Type::hybrid);
+        stencil = 5;
     }  // we only allow these options
     // Warn if using less than 3 ghost zones w/WENO etc, 2 w/Linear, etc.
     // SMR/AMR independently requires an even number of zones, so we usually use 4
@@ -128,13 +133,28 @@ std::shared_ptr<KHARMAPackage> Flux::Initialize(ParameterInput *pin, std::shared
     // Floors package *has* been initialized if it's going to be
     // Apply floors for high-order reconstructions
     bool default_recon_floors = packages->AllPackages().count("Floors") &&
-                                (recon == "weno5" || recon == "weno5_linear" || recon == "mp5");
+                                (recon == "weno5" || recon == "weno5_linear" || recon == "mp5" || recon == "hybrid");
     bool reconstruction_floors = pin->GetOrAddBoolean("flux", "reconstruction_floors", default_recon_floors);
     params.Add("reconstruction_floors", reconstruction_floors);
 
     bool reconstruction_fallback = pin->GetOrAddBoolean("flux", "reconstruction_fallback", false);
     params.Add("reconstruction_fallback", reconstruction_fallback);
 
+    // Reconstruct tile_rows neighboring rows in X2/X3 from one scratch tile, so that each row of primitives is
+    // read from memory once per tile rather than once per stencil (5-6 times).  No timings yet, so off by default.
+    // Ignored for X1 and schemes with their own row implementations (donor_cell, linear_vl)
+    bool tile_reconstruction = pin->GetOrAddBoolean("flux", "tile_reconstruction", false);
+    params.Add("tile_reconstruction", tile_reconstruction);
+    int tile_rows = pin->GetOrAddInteger("flux", "tile_rows", 8);
+    if (tile_rows < 1)
+        throw std::runtime_error("flux/tile_rows must be at least 1!");
+    params.Add("tile_rows", tile_rows);
+
+    // Smoothness threshold of the hybrid scheme: zones whose largest second difference is below this fraction
+    // of the local magnitude use PPM, the rest WENO5.  0 is pure WENO5
+    Real hybrid_threshold = pin->GetOrAddReal("flux", "hybrid_threshold", 0.01);
+    params.Add("hybrid_threshold", hybrid_threshold);
+
     // When calculating the fluxes, replace perpendicular fields (e.g. B2 at F2) with
     // the value already present at the face
     // Schemes universally do this, and it is very inadvisable to disable this
@@ -148,6 +168,81 @@ std::shared_ptr<KHARMAPackage> Flux::Initialize(ParameterInput *pin, std::shared
         params.Add("consistent_face_b", consistent_face_b);
     }
 
+    // Calculate fluxes in a single kernel, keeping the reconstructed states, conserved variables,
+    // and fluxes at faces in scratch memory rather than writing them to the temporaries below.
+    // See GetFluxFused in get_flux.hpp
+    // Optionally, calculate fluxes in all three directions from one kernel, which gathers the primitives
+    // around each block of multi_direction_tile^2 rows into scratch only once.
+    // This is a version of the fused kernel, see GetFluxMultiDir
+    bool multi_direction = pin->GetOrAddBoolean("flux", "multi_direction", false);
+    bool fused = pin->GetOrAddBoolean("flux", "fused", multi_direction);
+    if (multi_direction && !fused)
+        throw std::runtime_error("Multi-direction fluxes require fused flux calculation!");
+    if (multi_direction && (recon == "donor_cell" || recon == "linear_vl" || recon == "ppmx" || lower_edges || lower_poles))
+        throw std::runtime_error("Multi-direction fluxes require one of donor_cell_c, linear_mc, weno5, weno5_linear, ppm, mp5, hybrid!");
+    params.Add("multi_direction", multi_direction);
+    int multi_direction_tile = pin->GetOrAddInteger("flux", "multi_direction_tile", 4);
+    if (multi_direction_tile < 1)
+        throw std::runtime_error("flux/multi_direction_tile must be at least 1!");
+    params.Add("multi_direction_tile", multi_direction_tile);
+    params.Add("fused", fused);
+
+    // Choose which versions of the flux & P->U kernels to run, based on the loaded packages.
+    // See PhysicsSet in flux_functions.hpp
+    const auto& all_pkgs = packages->AllPackages();
+    const bool has_b = all_pkgs.count("B_CT") || all_pkgs.count("B_FluxCT") || all_pkgs.count("B_CD");
+    const bool has_emhd = all_pkgs.count("EMHD");
+    const bool has_electrons = all_pkgs.count("Electrons");
+    PhysicsSet physics_set = PhysicsSet::general;
+#if SPECIALIZE_PHYSICS
+    if (!all_pkgs.count("B_CD")) {
+        if (!has_b && !has_emhd && !has_electrons) {
+            physics_set = PhysicsSet::grhd;
+        } else if (has_b && !has_emhd && !has_electrons) {
+            physics_set = PhysicsSet::grmhd;
+        } else if (has_b && !has_emhd && has_electrons) {
+            physics_set = PhysicsSet::grmhd_electrons;
+        } else if (has_b && has_emhd && !has_electrons) {
+            physics_set = PhysicsSet::emhd;
+        }
+    }
+#endif
+    params.Add("physics_set", physics_set);
+
+    // Compute -divF, add the geometric source term, and apply the RK update to the cell-centered variables
+    // in one kernel, without writing dUdt.  KHARMA driver only, see Flux::FusedUpdate.
+    // This requires that no other package adds cell-centered sources.  B_CT's face source is still applied separately
+    bool fused_update = pin->GetOrAddBoolean("driver", "fused_update", false);
+    if (fused_update) {
+        if (packages->Get("Driver")->Param<DriverType>("type") != DriverType::kharma)
+            throw std::runtime_error("Fused update is only implemented for the KHARMA driver!");
+        for (auto& kpackage : packages->AllPackagesOfType<KHARMAPackage>()) {
+            if (kpackage.second->AddSource != nullptr && kpackage.first != "B_CT")
+                throw std::runtime_error("Fused update is incompatible with package "+kpackage.first+", which adds source terms!");
+        }
+    }
+    params.Add("fused_update", fused_update);
+
+    // Recover the fluid primitives and apply floors & ceilings in one kernel, see Floors::MeshUtoPAndFloors.
+    // KHARMA driver only.  The B field primitives are recovered first, so this requires that no other package
+    // needs the fluid primitives before floors are applied (electrons, EMHD)
+    bool fused_utop = pin->GetOrAddBoolean("driver", "fused_utop", false);
+    if (fused_utop) {
+        if (packages->Get("Driver")->Param<DriverType>("type") != DriverType::kharma)
+            throw std::runtime_error("Fused UtoP is only implemented for the KHARMA driver!");
+        if (!packages->AllPackages().count("Inverter") || !packages->AllPackages().count("Floors"))
+            throw std::runtime_error("Fused UtoP requires both the inverter and floors!");
+        if (packages->Get("Inverter")->Param<int>("first_pass_iter") > 0)
+            throw std::runtime_error("Fused UtoP is incompatible with inverter/first_pass_iter!");
+        for (auto& kpackage : packages->AllPackagesOfType<KHARMAPackage>()) {
+            if ((kpackage.second->MeshUtoP != nullptr || kpackage.second->BlockUtoP != nullptr ||
+                 kpackage.second->BlockApplyFloors != nullptr) &&
+                kpackage.first != "Inverter" && kpackage.first.rfind("B_", 0) != 0)
+                throw std::runtime_error("Fused UtoP is incompatible with package "+kpackage.first+", which recovers or floors primitives!");
+        }
+    }
+    params.Add("fused_utop", fused_utop);
+
     // We can't just use GetVariables or something since there's no mesh yet.
     // That's what this function is for.
     int nvar = KHARMA::PackDimension(packages.get(), Metadata::WithFluxes);
@@ -156,17 +251,35 @@ std::shared_ptr<KHARMAPackage> Flux::Initialize(ParameterInput *pin, std::shared
         std::cout << "Allocating fluxes for " << nvar << " variables" << std::endl;
     // TODO optionally move all these to faces? Not important yet, & faces have no output, more memory
     std::vector<MetadataFlag> flags_flux = {Metadata::Real, Metadata::Cell, Metadata::Derived, Metadata::OneCopy};
-    Metadata m = Metadata(flags_flux, s_flux);
-    pkg->AddField("Flux.Pr", m);
-    pkg->AddField("Flux.Pl", m);
-    pkg->AddField("Flux.Ur", m);
-    pkg->AddField("Flux.Ul", m);
-    pkg->AddField("Flux.Fr", m);
-    pkg->AddField("Flux.Fl", m);
+    Metadata m_flux = Metadata(flags_flux, s_flux);
+    // Whether to use FOFC, processed below
+    // Accept this a bunch of places, maybe we'll trim this...
+    bool default_fofc = false;
+    if (pin->DoesParameterExist("driver", "fofc")) {
+        default_fofc = pin->GetBoolean("driver", "fofc");
+    } else if (pin->DoesParameterExist("flux", "fofc")) {
+        default_fofc = pin->GetBoolean("flux", "fofc");
+    }
+    bool use_fofc = pin->GetOrAddBoolean("fofc", "on", default_fofc);
+    params.Add("use_fofc", use_fofc);
+
+    if (use_fofc || (!fused && !FLUX_SINGLE_PRECISION)) {
+        // FOFC uses the face temporaries as working space, so we need them even with fused fluxes
+        pkg->AddField("Flux.Pr", m_flux);
+        pkg->AddField("Flux.Pl", m_flux);
+        pkg->AddField("Flux.Ur", m_flux);
+        pkg->AddField("Flux.Ul", m_flux);
+        pkg->AddField("Flux.Fr", m_flux);
+        pkg->AddField("Flux.Fl", m_flux);
+    }
+    if (!fused && FLUX_SINGLE_PRECISION) {
+        // GetFlux keeps its own face temporaries in single precision, see FaceTemporaries in flux.hpp
+        params.Add("face_temporaries", KDomain::PartitionStore<FaceTemporaries>(), true);
+    }
 
     std::vector<int> s_vector({NVEC});
     std::vector<MetadataFlag> flags_speed = {Metadata::Real, Metadata::Cell, Metadata::Derived, Metadata::OneCopy};
-    m = Metadata(flags_speed, s_vector);
+    Metadata m = Metadata(flags_speed, s_vector);
     pkg->AddField("Flux.cmax", m);
     pkg->AddField("Flux.cmin", m);
 
@@ -179,16 +292,6 @@ std::shared_ptr<KHARMAPackage> Flux::Initialize(ParameterInput *pin, std::shared
     }
 
     // PROCESS FOFC
-    // Accept this a bunch of places, maybe we'll trim this...
-    bool default_fofc = false;
-    if (pin->DoesParameterExist("driver", "fofc")) {
-        default_fofc = pin->GetBoolean("driver", "fofc");
-    } else if (pin->DoesParameterExist("flux", "fofc")) {
-        default_fofc = pin->GetBoolean("flux", "fofc");
-    }
-    bool use_fofc = pin->GetOrAddBoolean("fofc", "on", default_fofc);
-    params.Add("use_fofc", use_fofc);
-
     if (use_fofc) {
         // FOFC-specific options
         bool use_glf = pin->GetOrAddBoolean("fofc", "use_glf", false);
@@ -270,6 +373,47 @@ TaskStatus Flux::BlockPtoUMHD(MeshBlockData<Real> *rc, IndexDomain domain, bool
     return TaskStatus::complete;
 }
 
+namespace Flux {
+/**
+ * Run Flux::p_to_u over a range of zones, for a particular set of packages
+ */
+template<PhysicsSet Phys>
+void PtoUZones(MeshBlock *pmb, const std::string& label, const IndexRange& kb, const IndexRange& jb, const IndexRange& ib,
+               const VariablePack<Real>& P, const VarMap& m_p, const VariablePack<Real>& U, const VarMap& m_u,
+               const EMHD::EMHD_parameters& emhd_params, const Real& gam)
+{
+    const auto& G = pmb->coords;
+    pmb->par_for(label, kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
+        KOKKOS_LAMBDA (const int &k, const int &j, const int &i) {
+            Flux::p_to_u<Phys>(G, P, m_p, emhd_params, gam, k, j, i, U, m_u);
+        }
+    );
+}
+void PtoUZones(MeshBlock *pmb, const std::string& label, const IndexRange& kb, const IndexRange& jb, const IndexRange& ib,
+               const VariablePack<Real>& P, const VarMap& m_p, const VariablePack<Real>& U, const VarMap& m_u,
+               const EMHD::EMHD_parameters& emhd_params, const Real& gam)
+{
+    switch (pmb->packages.Get("Flux")->Param<PhysicsSet>("physics_set")) {
+#if SPECIALIZE_PHYSICS
+    case PhysicsSet::grhd:
+        PtoUZones<PhysicsSet::grhd>(pmb, label, kb, jb, ib, P, m_p, U, m_u, emhd_params, gam);
+        break;
+    case PhysicsSet::grmhd:
+        PtoUZones<PhysicsSet::grmhd>(pmb, label, kb, jb, ib, P, m_p, U, m_u, emhd_params, gam);
+        break;
+    case PhysicsSet::grmhd_electrons:
+        PtoUZones<PhysicsSet::grmhd_electrons>(pmb, label, kb, jb, ib, P, m_p, U, m_u, emhd_params, gam);
+        break;
+    case PhysicsSet::emhd:
+        PtoUZones<PhysicsSet::emhd>(pmb, label, kb, jb, ib, P, m_p, U, m_u, emhd_params, gam);
+        break;
+#endif
+    default:
+        PtoUZones<PhysicsSet::general>(pmb, label, kb, jb, ib, P, m_p, U, m_u, emhd_params, gam);
+    }
+}
+} // namespace Flux
+
 TaskStatus Flux::BlockPtoU(MeshBlockData<Real> *rc, IndexDomain domain, bool coarse)
 {
     // Pointers
@@ -300,13 +444,7 @@ TaskStatus Flux::BlockPtoU(MeshBlockData<Real> *rc, IndexDomain domain, bool coa
     const IndexRange jb = bounds.GetBoundsJ(domain);
     const IndexRange kb = bounds.GetBoundsK(domain);
 
-    const auto& G = pmb->coords;
-
-    pmb->par_for("p_to_u", kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
-        KOKKOS_LAMBDA (const int &k, const int &j, const int &i) {
-            Flux::p_to_u(G, P, m_p, emhd_params, gam, k, j, i, U, m_u);
-        }
-    );
+    PtoUZones(pmb, "p_to_u", kb, jb, ib, P, m_p, U, m_u, emhd_params, gam);
 
     return TaskStatus::complete;
 }
@@ -378,14 +516,74 @@ TaskStatus Flux::BlockPtoU_Send(MeshBlockData<Real> *rc, IndexDomain domain, boo
         kb.e -= ng;
     } // TODO(BSP) error?
 
-    const auto& G = pmb->coords;
+    PtoUZones(pmb, "p_to_u_send", kb, jb, ib, P, m_p, U, m_u, emhd_params, gam);
 
-    pmb->par_for("p_to_u_send", kb.s, kb.e, jb.s, jb.e, ib.s, ib.e,
-        KOKKOS_LAMBDA (const int &k, const int &j, const int &i) {
-            Flux::p_to_u(G, P, m_p, emhd_params, gam, k, j, i, U, m_u);
+    return TaskStatus::complete;
+}
+
+TaskStatus Flux::FusedUpdate(MeshData<Real> *md_full_step_init, MeshData<Real> *md_sub_step_init,
+                             MeshData<Real> *md_update, std::vector<MetadataFlag> flags,
+                             const Real gam0, const Real gam1, const Real beta_dt)
+{
+    Flag("FusedUpdate");
+    // Pointers
+    auto pmb0 = md_sub_step_init->GetBlockData(0)->GetBlockPointer();
+    auto pkgs = pmb0->packages;
+    // Options
+    const Real gam = pkgs.Get("GRMHD")->Param<Real>("gamma");
+    const EMHD::EMHD_parameters& emhd_params = EMHD::GetEMHDParameters(pkgs);
+    // All connection coefficients are zero in Cartesian Minkowski space
+    const bool geo_source = !pmb0->coords.coords.is_cart_minkowski();
+
+    // Pack variables.  As in WeightedSumData, the packs of each state list variables in the same order
+    PackIndexMap prims_map, cons_map;
+    const auto& P    = md_sub_step_init->PackVariables(std::vector<MetadataFlag>{Metadata::GetUserFlag("Primitive")}, prims_map);
+    const auto& U_ss = md_sub_step_init->PackVariablesAndFluxes(flags, cons_map);
+    const auto& U_fs = md_full_step_init->PackVariables(flags);
+    auto U_out = md_update->PackVariables(flags);
+    const VarMap m_p(prims_map, false), m_u(cons_map, true);
+
+    const IndexRange3 b = KDomain::GetRange(md_sub_step_init, IndexDomain::interior);
+    const IndexRange block = IndexRange{0, U_ss.GetDim(5) - 1};
+    const int nvar = U_ss.GetDim(4);
+    const int ndim = U_ss.GetNdim();
+
+    pmb0->par_for("fused_update", block.s, block.e, b.ks, b.ke, b.js, b.je, b.is, b.ie,
+        KOKKOS_LAMBDA (const int& bl, const int &k, const int &j, const int &i) {
+            const auto& G = U_ss.GetCoords(bl);
+            // Geometric source term, exactly as in AddGeoSource
+            Real new_du[GR_DIM] = {0};
+            if (geo_source) {
+                FourVectors D;
+                GRMHD::calc_4vecs(G, P(bl), m_p, k, j, i, Loci::center, D);
+                Real Tmu[GR_DIM] = {0};
+                for (int mu = 0; mu < GR_DIM; ++mu) {
+                    Flux::calc_tensor(P(bl), m_p, D, emhd_params, gam, k, j, i, mu, Tmu);
+                    for (int nu = 0; nu < GR_DIM; ++nu) {
+                        for (int lam = 0; lam < GR_DIM; ++lam) {
+                            new_du[lam] += Tmu[nu] * G.gdet_conn(j, i, nu, lam, mu);
+                        }
+                    }
+                }
+            }
+
+            // -divF + S, then the weighted sum and update done by AddStateUpdate
+            const auto& v = U_ss(bl);
+            for (int l = 0; l < nvar; ++l) {
+                if (U_ss.IsAllocated(bl, l) && U_fs.IsAllocated(bl, l) && U_out.IsAllocated(bl, l)) {
+                    Real dudt = Update::FluxDivHelper(l, k, j, i, ndim, G, v);
+                    if (l == m_u.UU) {
+                        dudt += new_du[0];
+                    } else if (m_u.U1 >= 0 && l >= m_u.U1 && l < m_u.U1 + NVEC) {
+                        dudt += new_du[1 + l - m_u.U1];
+                    }
+                    U_out(bl, l, k, j, i) = gam0 * U_ss(bl, l, k, j, i) + gam1 * U_fs(bl, l, k, j, i) + beta_dt * dudt;
+                }
+            }
         }
     );
 
+    EndFlag();
     return TaskStatus::complete;
 }
 
@@ -74,6 +74,17 @@ inline TaskStatus AddGeoSourceTask(MeshData<Real> *md, MeshData<Real> *mdudt, In
     return TaskStatus::complete;
 }
 
+/**
+ * Fused version of the usual update sequence FluxDivergence -> AddSource -> AddStateUpdate for cell-centered
+ * variables matching 'flags', used with driver/fused_update.  Computes -divF + the geometric source term
+ * zone-by-zone and applies it immediately:
+ * md_update = gam0 * md_sub_step_init + gam1 * md_full_step_init + beta_dt * (-divF + S)
+ * without writing dUdt.  Valid only if no other package adds cell-centered source terms.
+ */
+TaskStatus FusedUpdate(MeshData<Real> *md_full_step_init, MeshData<Real> *md_sub_step_init,
+                       MeshData<Real> *md_update, std::vector<MetadataFlag> flags,
+                       const Real gam0, const Real gam1, const Real beta_dt);
+
 /**
  * Likewise, the conversion P->U, even for just the GRMHD variables, requires (consists of)
  * the stress-energy tensor.
@@ -99,6 +110,31 @@ TaskStatus BlockPtoU_Send(MeshBlockData<Real> *rc, IndexDomain domain, bool coar
  */
 int CountFOFCFlags(MeshData<Real> *md);
 
+/**
+ * Single-precision face temporaries for the split GetFlux, used in place of the fields
+ * Flux.Pl/Pr/Ul/Ur/Fl/Fr when compiled with KHARMA_FLUX_SINGLE_PRECISION.
+ * All arithmetic is still done in double, values are just rounded when stored.
+ * One set is kept for each MeshData partition, see Flux "face_temporaries"
+ */
+struct FaceTemporaries {
+    Kokkos::View<float*****> Pl, Pr, Ul, Ur, Fl, Fr;
+
+    // Make sure each is (nblocks, nvar, n3, n2, n1), reallocating only if the shape changed
+    void Allocate(const int& nblocks, const int& nvar, const int& n3, const int& n2, const int& n1)
+    {
+        if (Pl.extent_int(0) == nblocks && Pl.extent_int(1) == nvar && Pl.extent_int(2) == n3
+            && Pl.extent_int(3) == n2 && Pl.extent_int(4) == n1)
+            return;
+        const auto alloc = [&](const std::string& name) {
+            return Kokkos::View<float*****>(Kokkos::view_alloc(name, Kokkos::WithoutInitializing),
+                                            nblocks, nvar, n3, n2, n1);
+        };
+        Pl = alloc("Flux.Pl_sp"); Pr = alloc("Flux.Pr_sp");
+        Ul = alloc("Flux.Ul_sp"); Ur = alloc("Flux.Ur_sp");
+        Fl = alloc("Flux.Fl_sp"); Fr = alloc("Flux.Fr_sp");
+    }
+};
+
 // Fluxes a.k.a. "Approximate Riemann Solvers"
 // More complex solvers require speed estimates not calculable completely from
 // invariants, necessitating frame transformations and related madness.
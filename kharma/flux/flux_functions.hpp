@@ -49,13 +49,32 @@
 namespace Flux
 {
 
+/**
+ * Sets of packages which commonly run together.  The flux and P->U kernels are compiled for each,
+ * with the checks for packages outside the set removed at compile time.  The set is chosen once
+ * in Flux::Initialize; anything unusual (e.g. B_CD, or EMHD w/electrons) gets "general", which
+ * checks each package at runtime as before.
+ * Note these only say which packages *may* be present: VarMap indices are still checked, so
+ * "general" is always a correct choice.
+ */
+enum class PhysicsSet{general=0, grhd, grmhd, grmhd_electrons, emhd};
+
+template<PhysicsSet Phys>
+KOKKOS_FORCEINLINE_FUNCTION constexpr bool has_b() { return Phys != PhysicsSet::grhd; }
+template<PhysicsSet Phys>
+KOKKOS_FORCEINLINE_FUNCTION constexpr bool has_psi() { return Phys == PhysicsSet::general; }
+template<PhysicsSet Phys>
+KOKKOS_FORCEINLINE_FUNCTION constexpr bool has_emhd() { return Phys == PhysicsSet::general || Phys == PhysicsSet::emhd; }
+template<PhysicsSet Phys>
+KOKKOS_FORCEINLINE_FUNCTION constexpr bool has_electrons() { return Phys == PhysicsSet::general || Phys == PhysicsSet::grmhd_electrons; }
+
 // TODO Q > 0 != emhd_enabled.  Store enablement in emhd_params since we need it anyway
-template<typename Local>
+template<PhysicsSet Phys=PhysicsSet::general, typename Local>
 KOKKOS_FORCEINLINE_FUNCTION void calc_tensor(const Local& P, const VarMap& m_p, const FourVectors D,
                                         const EMHD::EMHD_parameters& emhd_params, const Real& gam, const int& dir,
                                         Real T[GR_DIM])
 {
-    if (m_p.Q >= 0 || m_p.DP >= 0) {
+    if (has_emhd<Phys>() && (m_p.Q >= 0 || m_p.DP >= 0)) {
         // Apply higher-order terms conversion if necessary
         Real qtilde = 0., dPtilde = 0.;
         if (m_p.Q >= 0)
@@ -69,7 +88,7 @@ KOKKOS_FORCEINLINE_FUNCTION void calc_tensor(const Local& P, const VarMap& m_p,
 
         // Then calculate the tensor
         EMHD::calc_tensor(P(m_p.RHO), P(m_p.UU), (gam - 1) * P(m_p.UU), emhd_params, q, dP, D, dir, T);
-    } else if (m_p.B1 >= 0) {
+    } else if (has_b<Phys>() && m_p.B1 >= 0) {
         // GRMHD stress-energy tensor w/ first index up, second index down
         GRMHD::calc_tensor(P(m_p.RHO), P(m_p.UU), (gam - 1) * P(m_p.UU), D, dir, T);
     } else {
@@ -78,13 +97,13 @@ KOKKOS_FORCEINLINE_FUNCTION void calc_tensor(const Local& P, const VarMap& m_p,
     }
 }
 
-template<typename Global>
+template<PhysicsSet Phys=PhysicsSet::general, typename Global>
 KOKKOS_FORCEINLINE_FUNCTION void calc_tensor(const Global& P, const VarMap& m_p, const FourVectors D,
                                         const EMHD::EMHD_parameters& emhd_params, const Real& gam, 
                                         const int& k, const int& j, const int& i, const int& dir,
                                         Real T[GR_DIM])
 {
-    if (m_p.Q >= 0 || m_p.DP >= 0) {
+    if (has_emhd<Phys>() && (m_p.Q >= 0 || m_p.DP >= 0)) {
         // Apply higher-order terms conversion if necessary
         Real qtilde = 0., dPtilde = 0.;
         if (m_p.Q >= 0)
@@ -98,7 +117,7 @@ KOKKOS_FORCEINLINE_FUNCTION void calc_tensor(const Global& P, const VarMap& m_p,
 
         // Then calculate the tensor
         EMHD::calc_tensor(P(m_p.RHO, k, j, i), P(m_p.UU, k, j, i), (gam - 1) * P(m_p.UU, k, j, i), emhd_params, q, dP, D, dir, T);
-    } else if (m_p.B1 >= 0) {
+    } else if (has_b<Phys>() && m_p.B1 >= 0) {
         // GRMHD stress-energy tensor w/ first index up, second index down
         GRMHD::calc_tensor(P(m_p.RHO, k, j, i), P(m_p.UU, k, j, i), (gam - 1) * P(m_p.UU, k, j, i), D, dir, T);
     } else {
@@ -113,7 +132,7 @@ KOKKOS_FORCEINLINE_FUNCTION void calc_tensor(const Global& P, const VarMap& m_p,
  * b. fluxes in a direction (dir!=0)
  * Keep in mind loc should usually correspond to dir for perpendicuar fluxes
  */
-template<typename Local>
+template<PhysicsSet Phys=PhysicsSet::general, typename Local>
 KOKKOS_FORCEINLINE_FUNCTION void prim_to_flux(const GRCoordinates& G, const Local& P, const VarMap& m_p, const FourVectors D,
                                          const EMHD::EMHD_parameters& emhd_params, const Real& gam, const int& j, const int& i, const int& dir,
                                          const Local& flux, const VarMap& m_u, const Loci loc=Loci::center)
@@ -124,14 +143,14 @@ KOKKOS_FORCEINLINE_FUNCTION void prim_to_flux(const GRCoordinates& G, const Loca
 
     // Stress-energy tensor
     Real T[GR_DIM];
-    calc_tensor(P, m_p, D, emhd_params, gam, dir, T);
+    calc_tensor<Phys>(P, m_p, D, emhd_params, gam, dir, T);
     flux(m_u.UU) = T[0] * gdet + flux(m_u.RHO);
     flux(m_u.U1) = T[1] * gdet;
     flux(m_u.U2) = T[2] * gdet;
     flux(m_u.U3) = T[3] * gdet;
 
     // Magnetic field
-    if (m_u.B1 >= 0) {
+    if (has_b<Phys>() && m_u.B1 >= 0) {
         // Magnetic field
         if (dir == 0) {
             VLOOP flux(m_u.B1 + v) = P(m_p.B1 + v) * gdet;
@@ -141,7 +160,7 @@ KOKKOS_FORCEINLINE_FUNCTION void prim_to_flux(const GRCoordinates& G, const Loca
             VLOOP flux(m_u.B1 + v) = (D.bcon[v+1] * D.ucon[dir] - D.bcon[dir] * D.ucon[v+1]) * gdet;
         }
         // Extra scalar psi for constraint damping, see B_CD
-        if (m_u.PSI >= 0) {
+        if (has_psi<Phys>() && m_u.PSI >= 0) {
             if (dir == 0) {
                 flux(m_u.PSI) = P(m_p.PSI) * gdet;
             } else {
@@ -154,13 +173,13 @@ KOKKOS_FORCEINLINE_FUNCTION void prim_to_flux(const GRCoordinates& G, const Loca
     }
 
     // EMHD Variables: advect like rho
-    if (m_u.Q >= 0)
+    if (has_emhd<Phys>() && m_u.Q >= 0)
         flux(m_u.Q) = P(m_p.Q) * D.ucon[dir] * gdet;
-    if (m_u.DP >= 0)
+    if (has_emhd<Phys>() && m_u.DP >= 0)
         flux(m_u.DP) = P(m_p.DP) * D.ucon[dir] * gdet;
 
     // Electrons: normalized by density
-    if (m_u.KTOT >= 0) {
+    if (has_electrons<Phys>() && m_u.KTOT >= 0) {
         flux(m_u.KTOT) = flux(m_u.RHO) * P(m_p.KTOT);
         if (m_u.K_CONSTANT >= 0)
             flux(m_u.K_CONSTANT) = flux(m_u.RHO) * P(m_p.K_CONSTANT);
@@ -177,7 +196,7 @@ KOKKOS_FORCEINLINE_FUNCTION void prim_to_flux(const GRCoordinates& G, const Loca
     }
 }
 
-template<typename Global>
+template<PhysicsSet Phys=PhysicsSet::general, typename Global>
 KOKKOS_FORCEINLINE_FUNCTION void prim_to_flux(const GRCoordinates& G, const Global& P, const VarMap& m_p, const FourVectors D,
                                          const EMHD::EMHD_parameters& emhd_params, const Real& gam, 
                                          const int& k, const int& j, const int& i, const int dir,
@@ -188,14 +207,14 @@ KOKKOS_FORCEINLINE_FUNCTION void prim_to_flux(const GRCoordinates& G, const Glob
     flux(m_u.RHO, k, j, i) = P(m_p.RHO, k, j, i) * D.ucon[dir] * gdet;
 
     Real T[GR_DIM];
-    calc_tensor(P, m_p, D, emhd_params, gam, k, j, i, dir, T);
+    calc_tensor<Phys>(P, m_p, D, emhd_params, gam, k, j, i, dir, T);
     flux(m_u.UU, k, j, i) = T[0] * gdet + flux(m_u.RHO, k, j, i);
     flux(m_u.U1, k, j, i) = T[1] * gdet;
     flux(m_u.U2, k, j, i) = T[2] * gdet;
     flux(m_u.U3, k, j, i) = T[3] * gdet;
 
     // Magnetic field
-    if (m_u.B1 >= 0) {
+    if (has_b<Phys>() && m_u.B1 >= 0) {
         // Magnetic field
         if (dir == 0) {
             VLOOP flux(m_u.B1 + v, k, j, i) = P(m_p.B1 + v, k, j, i) * gdet;
@@ -205,7 +224,7 @@ KOKKOS_FORCEINLINE_FUNCTION void prim_to_flux(const GRCoordinates& G, const Glob
             VLOOP flux(m_u.B1 + v, k, j, i) = (D.bcon[v+1] * D.ucon[dir] - D.bcon[dir] * D.ucon[v+1]) * gdet;
         }
         // Extra scalar psi for constraint damping, see B_CD
-        if (m_u.PSI >= 0) {
+        if (has_psi<Phys>() && m_u.PSI >= 0) {
             if (dir == 0) {
                 flux(m_u.PSI, k, j, i) = P(m_p.PSI, k, j, i) * gdet;
             } else {
@@ -218,13 +237,13 @@ KOKKOS_FORCEINLINE_FUNCTION void prim_to_flux(const GRCoordinates& G, const Glob
     }
 
     // EMHD Variables: advect like rho
-    if (m_u.Q >= 0)
+    if (has_emhd<Phys>() && m_u.Q >= 0)
         flux(m_u.Q, k, j, i)  = P(m_p.Q, k, j, i) * D.ucon[dir] * gdet;
-    if (m_u.DP >= 0)
+    if (has_emhd<Phys>() && m_u.DP >= 0)
         flux(m_u.DP, k, j, i) = P(m_p.DP, k, j, i) * D.ucon[dir] * gdet;
 
     // Electrons: normalized by density
-    if (m_u.KTOT >= 0) {
+    if (has_electrons<Phys>() && m_u.KTOT >= 0) {
         flux(m_u.KTOT, k, j, i)  = flux(m_u.RHO, k, j, i) * P(m_p.KTOT, k, j, i);
         if (m_u.K_CONSTANT >= 0)
             flux(m_u.K_CONSTANT, k, j, i) = flux(m_u.RHO, k, j, i) * P(m_p.K_CONSTANT, k, j, i);
@@ -265,17 +284,17 @@ KOKKOS_FORCEINLINE_FUNCTION void prim_to_flux_mhd(const GRCoordinates& G, const
 /**
  * Get the conserved (E)GRMHD variables corresponding to primitives in a zone. Equivalent to prim_to_flux with dir==0
  */
-template<typename Local>
+template<PhysicsSet Phys=PhysicsSet::general, typename Local>
 KOKKOS_FORCEINLINE_FUNCTION void p_to_u(const GRCoordinates& G, const Local& P, const VarMap& m_p,
                                    const EMHD::EMHD_parameters& emhd_params, const Real& gam, const int& j, const int& i,
                                    const Local& U, const VarMap& m_u, const Loci& loc=Loci::center)
 {
     FourVectors Dtmp;
     GRMHD::calc_4vecs(G, P, m_p, j, i, loc, Dtmp);
-    prim_to_flux(G, P, m_p, Dtmp, emhd_params, gam, j, i, 0, U, m_u, loc);
+    prim_to_flux<Phys>(G, P, m_p, Dtmp, emhd_params, gam, j, i, 0, U, m_u, loc);
 }
 
-template<typename Global>
+template<PhysicsSet Phys=PhysicsSet::general, typename Global>
 KOKKOS_FORCEINLINE_FUNCTION void p_to_u(const GRCoordinates& G, const Global& P, const VarMap& m_p,
                                    const EMHD::EMHD_parameters& emhd_params, const Real& gam, 
                                    const int& k, const int& j, const int& i,
@@ -283,7 +302,7 @@ KOKKOS_FORCEINLINE_FUNCTION void p_to_u(const GRCoordinates& G, const Global& P,
 {
     FourVectors Dtmp;
     GRMHD::calc_4vecs(G, P, m_p, k, j, i, Loci::center, Dtmp);
-    prim_to_flux(G, P, m_p, Dtmp, emhd_params, gam, k, j, i, 0, U, m_u, loc);
+    prim_to_flux<Phys>(G, P, m_p, Dtmp, emhd_params, gam, k, j, i, 0, U, m_u, loc);
 }
 
 template<typename Global>
@@ -300,7 +319,7 @@ KOKKOS_FORCEINLINE_FUNCTION void p_to_u_mhd(const GRCoordinates& G, const Global
 /**
  * Calculate components of magnetosonic velocity from primitive variables
  */
-template<typename Local>
+template<PhysicsSet Phys=PhysicsSet::general, typename Local>
 KOKKOS_FORCEINLINE_FUNCTION void vchar(const GRCoordinates& G, const Local& P, const VarMap& m, const FourVectors& D,
                                   const Real& gam, const EMHD::EMHD_parameters& emhd_params, 
                                   const int& k, const int& j, const int& i, const Loci& loc, const int& dir,
@@ -310,7 +329,7 @@ KOKKOS_FORCEINLINE_FUNCTION void vchar(const GRCoordinates& G, const Local& P, c
     const Real ef  = P(m.RHO) + gam * P(m.UU);
     const Real cs2 = gam * (gam - 1) * P(m.UU) / ef;
     Real cms2;
-    if (m.Q >= 0 || m.DP >= 0) {
+    if (has_emhd<Phys>() && (m.Q >= 0 || m.DP >= 0)) {
          // Get the EGRMHD parameters
         Real tau, chi_e, nu_e;
         EMHD::set_parameters(G, P, m, emhd_params, gam, j, i, tau, chi_e, nu_e);
@@ -329,7 +348,7 @@ KOKKOS_FORCEINLINE_FUNCTION void vchar(const GRCoordinates& G, const Local& P, c
         const Real cs2_emhd = 0.5*(cs2 + ccond2 + m::sqrt(cs2*cs2 + ccond2*ccond2)) + cvis2;
 
         cms2 = cs2_emhd + va2 - cs2_emhd*va2;
-    } else if (m.B1 >= 0) {
+    } else if (has_b<Phys>() && m.B1 >= 0) {
         // Find fast magnetosonic speed
         const Real bsq = dot(D.bcon, D.bcov);
         const Real va2 = bsq / (bsq + ef);
@@ -343,18 +362,15 @@ KOKKOS_FORCEINLINE_FUNCTION void vchar(const GRCoordinates& G, const Local& P, c
     // Require that speed of wave measured by observer q.ucon is cms2
     Real A, B, C;
     {
-        Real Bcov[GR_DIM] = {1., 0., 0., 0.};
-        Real Acov[GR_DIM] = {0}; Acov[dir] = 1.;
-
-        Real Acon[GR_DIM], Bcon[GR_DIM];
-        G.raise(Acov, Acon, k, j, i, loc);
-        G.raise(Bcov, Bcon, k, j, i, loc);
-
-        const Real Asq  = dot(Acon, Acov);
-        const Real Bsq  = dot(Bcon, Bcov);
-        const Real Au   = dot(Acov, D.ucon);
-        const Real Bu   = dot(Bcov, D.ucon);
-        const Real AB   = dot(Acon, Bcov);
+        // With Acov = e_dir and Bcov = e_0, the products below are just g^{dir dir}, g^{00}, g^{0 dir}.
+        // Take these from the 3+1 cache rather than raising both vectors with the full metric
+        const Real alpha = G.lapse(loc, j, i);
+        const Real beta_dir = G.shift(loc, j, i, dir);
+        const Real Bsq  = -1. / (alpha * alpha);
+        const Real AB   = -beta_dir * Bsq;
+        const Real Asq  = G.gamma_con(loc, j, i, dir, dir) + beta_dir * beta_dir * Bsq;
+        const Real Au   = D.ucon[dir];
+        const Real Bu   = D.ucon[0];
 
         A = Bu*Bu - (Bsq + Bu*Bu) * cms2;
         B = 2. * (Au*Bu - (AB + Au*Bu) * cms2);
@@ -372,7 +388,7 @@ KOKKOS_FORCEINLINE_FUNCTION void vchar(const GRCoordinates& G, const Local& P, c
 
 // This is expressly for updating cmin/max for FOFC zones
 // It's named differently because it already took k,j,i so we can't pull the overloading w/different signatures trick
-template<typename Global>
+template<PhysicsSet Phys=PhysicsSet::general, typename Global>
 KOKKOS_FORCEINLINE_FUNCTION void vchar_global(const GRCoordinates& G, const Global& P, const VarMap& m, const FourVectors& D,
                                   const Real& gam, const EMHD::EMHD_parameters& emhd_params, 
                                   const int& k, const int& j, const int& i, const Loci& loc, const int& dir,
@@ -382,7 +398,7 @@ KOKKOS_FORCEINLINE_FUNCTION void vchar_global(const GRCoordinates& G, const Glob
     const Real ef  = P(m.RHO, k, j, i) + gam * P(m.UU, k, j, i);
     const Real cs2 = gam * (gam - 1) * P(m.UU, k, j, i) / ef;
     Real cms2;
-    if (m.Q >= 0 || m.DP >= 0) {
+    if (has_emhd<Phys>() && (m.Q >= 0 || m.DP >= 0)) {
          // Get the EGRMHD parameters
         Real tau, chi_e, nu_e;
         EMHD::set_parameters(G, P, m, emhd_params, gam, k, j, i, tau, chi_e, nu_e);
@@ -401,7 +417,7 @@ KOKKOS_FORCEINLINE_FUNCTION void vchar_global(const GRCoordinates& G, const Glob
         const Real cs2_emhd = 0.5*(cs2 + ccond2 + m::sqrt(cs2*cs2 + ccond2*ccond2)) + cvis2;
 
         cms2 = cs2_emhd + va2 - cs2_emhd*va2;
-    } else if (m.B1 >= 0) {
+    } else if (has_b<Phys>() && m.B1 >= 0) {
         // Find fast magnetosonic speed
         const Real bsq = dot(D.bcon, D.bcov);
         const Real va2 = bsq / (bsq + ef);
@@ -414,18 +430,15 @@ KOKKOS_FORCEINLINE_FUNCTION void vchar_global(const GRCoordinates& G, const Glob
     // Require that speed of wave measured by observer q.ucon is cms2
     Real A, B, C;
     {
-        Real Bcov[GR_DIM] = {1., 0., 0., 0.};
-        Real Acov[GR_DIM] = {0}; Acov[dir] = 1.;
-
-        Real Acon[GR_DIM], Bcon[GR_DIM];
-        G.raise(Acov, Acon, k, j, i, loc);
-        G.raise(Bcov, Bcon, k, j, i, loc);
-
-        const Real Asq  = dot(Acon, Acov);
-        const Real Bsq  = dot(Bcon, Bcov);
-        const Real Au   = dot(Acov, D.ucon);
-        const Real Bu   = dot(Bcov, D.ucon);
-        const Real AB   = dot(Acon, Bcov);
+        // With Acov = e_dir and Bcov = e_0, the products below are just g^{dir dir}, g^{00}, g^{0 dir}.
+        // Take these from the 3+1 cache rather than raising both vectors with the full metric
+        const Real alpha = G.lapse(loc, j, i);
+        const Real beta_dir = G.shift(loc, j, i, dir);
+        const Real Bsq  = -1. / (alpha * alpha);
+        const Real AB   = -beta_dir * Bsq;
+        const Real Asq  = G.gamma_con(loc, j, i, dir, dir) + beta_dir * beta_dir * Bsq;
+        const Real Au   = D.ucon[dir];
+        const Real Bu   = D.ucon[0];
 
         A = Bu*Bu - (Bsq + Bu*Bu) * cms2;
         B = 2. * (Au*Bu - (AB + Au*Bu) * cms2);
@@ -40,6 +40,11 @@
 
 namespace Flux {
 
+template <KReconstruction::Type Recon, int dir, PhysicsSet Phys>
+inline TaskStatus GetFluxFused(MeshData<Real> *md);
+template <KReconstruction::Type Recon, PhysicsSet Phys>
+inline TaskStatus GetFluxMultiDir(MeshData<Real> *md);
+
 /**
  * @brief Reconstruct the values of primitive variables at left and right of each zone face,
  * find the corresponding conserved variables and their fluxes through the face
@@ -56,8 +61,9 @@ namespace Flux {
  * need fluxes in three directions, we can recompile the function for every combination.
  * This allows some extra optimization from knowing that dir != 0 in parcticular, and inlining
  * the particular reconstruction call we need.
+ * It is also compiled for each common set of physics packages, see PhysicsSet in flux_functions.hpp
  */
-template <KReconstruction::Type Recon, int dir>
+template <KReconstruction::Type Recon, int dir, PhysicsSet Phys = PhysicsSet::general>
 inline TaskStatus GetFlux(MeshData<Real> *md)
 {
     // Pointers
@@ -69,10 +75,38 @@ inline TaskStatus GetFlux(MeshData<Real> *md)
     if (ndim < 3 && dir == X3DIR) return TaskStatus::complete;
     if (ndim < 2 && dir == X2DIR) return TaskStatus::complete;
 
-    Flag("GetFlux_"+std::to_string(dir));
-
     // Options
     const auto& pars       = packages.Get("Flux")->AllParams();
+
+#if SPECIALIZE_PHYSICS
+    // Call through to the version compiled for the packages we're running
+    if constexpr (Phys == PhysicsSet::general) {
+        switch (pars.Get<PhysicsSet>("physics_set")) {
+        case PhysicsSet::grhd:
+            return GetFlux<Recon, dir, PhysicsSet::grhd>(md);
+        case PhysicsSet::grmhd:
+            return GetFlux<Recon, dir, PhysicsSet::grmhd>(md);
+        case PhysicsSet::grmhd_electrons:
+            return GetFlux<Recon, dir, PhysicsSet::grmhd_electrons>(md);
+        case PhysicsSet::emhd:
+            return GetFlux<Recon, dir, PhysicsSet::emhd>(md);
+        default:
+            break;
+        }
+    }
+#endif
+
+    // Version computing all three directions in one kernel, see below.  It runs in place of the X1 task
+    if constexpr (KReconstruction::TileSupported<Recon>()) {
+        if (pars.Get<bool>("multi_direction"))
+            return (dir == X1DIR) ? GetFluxMultiDir<Recon, Phys>(md) : TaskStatus::complete;
+    }
+
+    // Single-kernel version which never writes the face states to the mesh, see below
+    if (pars.Get<bool>("fused")) return GetFluxFused<Recon, dir, Phys>(md);
+
+    Flag("GetFlux_"+std::to_string(dir));
+
     const auto& mhd_pars   = packages.Get("GRMHD")->AllParams();
     const auto& globals    = packages.Get("Globals")->AllParams();
     const bool use_hlle    = pars.Get<bool>("use_hlle");
@@ -88,6 +122,9 @@ inline TaskStatus GetFlux(MeshData<Real> *md)
     const Floors::Prescription& floors = floors_temp;
 
     const bool reconstruction_fallback = pars.Get<bool>("reconstruction_fallback");
+    const bool tile_reconstruction = pars.Get<bool>("tile_reconstruction");
+    const int tile_rows = pars.Get<int>("tile_rows");
+    const Real hybrid_threshold = pars.Get<Real>("hybrid_threshold");
 
     const Real gam = mhd_pars.Get<Real>("gamma");
 
@@ -109,13 +146,6 @@ inline TaskStatus GetFlux(MeshData<Real> *md)
     const auto& U_all = md->PackVariablesAndFluxes(std::vector<MetadataFlag>{Metadata::Conserved, Metadata::Cell}, cons_map);
     const VarMap m_u(cons_map, true), m_p(prims_map, false);
 
-    const auto& Pl_all = md->PackVariables(std::vector<std::string>{"Flux.Pl"});
-    const auto& Pr_all = md->PackVariables(std::vector<std::string>{"Flux.Pr"});
-    const auto& Ul_all = md->PackVariables(std::vector<std::string>{"Flux.Ul"});
-    const auto& Ur_all = md->PackVariables(std::vector<std::string>{"Flux.Ur"});
-    const auto& Fl_all = md->PackVariables(std::vector<std::string>{"Flux.Fl"});
-    const auto& Fr_all = md->PackVariables(std::vector<std::string>{"Flux.Fr"});
-
     // Get the domain size
     // We need fluxes outside the domain for flux-CT and FOFC: one extra zone update on each side
     const IndexRange3 b = KDomain::GetRange(md, IndexDomain::interior, FaceOf(dir), -1, 1);
@@ -124,6 +154,22 @@ inline TaskStatus GetFlux(MeshData<Real> *md)
     const IndexRange block = IndexRange{0, cmax.GetDim(5) - 1};
     const int nvar = U_all.GetDim(4);
 
+#if FLUX_SINGLE_PRECISION
+    auto& face = packages.Get("Flux")->AllParams().GetMutable<KDomain::PartitionStore<FaceTemporaries>>("face_temporaries")->Get(md);
+    face.Allocate(block.e + 1, nvar, pmb0->cellbounds.ncellsk(IndexDomain::entire),
+                  pmb0->cellbounds.ncellsj(IndexDomain::entire), n1);
+    const auto Pl_all = face.Pl, Pr_all = face.Pr;
+    const auto Ul_all = face.Ul, Ur_all = face.Ur;
+    const auto Fl_all = face.Fl, Fr_all = face.Fr;
+#else
+    const auto& Pl_all = md->PackVariables(std::vector<std::string>{"Flux.Pl"});
+    const auto& Pr_all = md->PackVariables(std::vector<std::string>{"Flux.Pr"});
+    const auto& Ul_all = md->PackVariables(std::vector<std::string>{"Flux.Ul"});
+    const auto& Ur_all = md->PackVariables(std::vector<std::string>{"Flux.Ur"});
+    const auto& Fl_all = md->PackVariables(std::vector<std::string>{"Flux.Fl"});
+    const auto& Fr_all = md->PackVariables(std::vector<std::string>{"Flux.Fr"});
+#endif
+
     if (globals.Get<int>("verbose") > 2) {
         std::cout << "Calculating fluxes for " << cmax.GetDim(5) << " blocks, "
                 << nvar << " variables (" << P_all.GetDim(4) << " primitives)" << std::endl;
@@ -131,81 +177,98 @@ inline TaskStatus GetFlux(MeshData<Real> *md)
         emhd_params.print();
     }
 
+    // Teams reconstruct one row each, or with tiles, several consecutive rows in the direction of reconstruction
+    using RType = KReconstruction::Type;
+    const bool tiled = KReconstruction::UseTile<Recon, dir>(tile_reconstruction);
+    const int nrows = KReconstruction::TileRows<Recon, dir>(tile_reconstruction, tile_rows);
+    const int ntile = KReconstruction::TileSize<Recon, dir>(tile_reconstruction, nrows);
+    const IndexRange kt = (dir == X3DIR) ? IndexRange{0, ((int) b.ke - (int) b.ks) / nrows} : IndexRange{(int) b.ks, (int) b.ke};
+    const IndexRange jt = (dir == X2DIR) ? IndexRange{0, ((int) b.je - (int) b.js) / nrows} : IndexRange{(int) b.js, (int) b.je};
+
     // Allocate scratch space
     const int scratch_level = 1; // 0 is actual scratch (tiny); 1 is HBM
     const size_t var_size_in_bytes = parthenon::ScratchPad2D<Real>::shmem_size(nvar, n1);
     const size_t line_size_in_bytes = parthenon::ScratchPad1D<int>::shmem_size(n1);
     // Allocate enough to cache prims, conserved, and fluxes, for left and right faces,
-    // plus temporaries inside reconstruction (most use none, donor_cell uses one, linear_vl uses a bunch)
-    using RType = KReconstruction::Type;
-    const size_t recon_scratch_bytes = (4 + 1*(Recon == RType::donor_cell) +
+    // plus temporaries inside reconstruction (most use none, donor_cell uses one, linear_vl uses a bunch),
+    // plus flags and a compacted list of faces which need to fall back to PPM, plus any tile
+    const size_t recon_scratch_bytes = (2 + 1*(Recon == RType::donor_cell) +
                                             5*(Recon == RType::linear_vl)) * var_size_in_bytes +
-                                        line_size_in_bytes;
+                                        2 * line_size_in_bytes +
+                                        parthenon::ScratchPad3D<Real>::shmem_size(P_all.GetDim(4), ntile, n1);
     const size_t flux_scratch_bytes = 3 * var_size_in_bytes;
 
     // This isn't a pmb0->par_for_outer because Parthenon's current overloaded definitions
     // do not accept three pairs of bounds, which we need in order to iterate over blocks
     Flag("GetFlux_"+std::to_string(dir)+"_recon");
     parthenon::par_for_outer(DEFAULT_OUTER_LOOP_PATTERN, "calc_flux_recon", pmb0->exec_space,
-        recon_scratch_bytes, scratch_level, block.s, block.e, b.ks, b.ke, b.js, b.je,
-        KOKKOS_LAMBDA(parthenon::team_mbr_t member, const int& bl, const int& k, const int& j) {
+        recon_scratch_bytes, scratch_level, block.s, block.e, kt.s, kt.e, jt.s, jt.e,
+        KOKKOS_LAMBDA(parthenon::team_mbr_t member, const int& bl, const int& kt_, const int& jt_) {
             const auto& G = U_all.GetCoords(bl);
             ScratchPad2D<Real> Pl_s(member.team_scratch(scratch_level), nvar, n1);
             ScratchPad2D<Real> Pr_s(member.team_scratch(scratch_level), nvar, n1);
-            ScratchPad2D<Real> Plf_s(member.team_scratch(scratch_level), nvar, n1);
-            ScratchPad2D<Real> Prf_s(member.team_scratch(scratch_level), nvar, n1);
             ScratchPad1D<int> fallback_tvd(member.team_scratch(scratch_level), n1);
+            ScratchPad1D<int> fallback_list(member.team_scratch(scratch_level), n1);
+            ScratchPad3D<Real> tile_s(member.team_scratch(scratch_level), P_all.GetDim(4), ntile, n1);
+
+            // First row of this team & number of rows
+            const int k0 = (dir == X3DIR) ? (int) b.ks + kt_ * nrows : kt_;
+            const int j0 = (dir == X2DIR) ? (int) b.js + jt_ * nrows : jt_;
+            const int nr = (dir == X3DIR) ? m::min(nrows, (int) b.ke - k0 + 1) :
+                           ((dir == X2DIR) ? m::min(nrows, (int) b.je - j0 + 1) : 1);
+            if constexpr (dir != X1DIR) {
+                if (tiled) {
+                    KReconstruction::GatherRowTile<dir>(member, P_all(bl), k0, j0, nr, b.is, b.ie, tile_s);
+                    member.team_barrier();
+                }
+            }
 
-            // We template on reconstruction type to avoid a big switch statement here.
-            // Instead, a version of GetFlux() is generated separately for each reconstruction/direction pair.
-            // See reconstruction.hpp for all the implementations.
-            KReconstruction::ReconstructRow<Recon, dir>(member, P_all(bl), k, j, b.is, b.ie, Pl_s, Pr_s);
+            for (int r = 0; r < nr; ++r) {
+                const int k = (dir == X3DIR) ? k0 + r : k0;
+                const int j = (dir == X2DIR) ? j0 + r : j0;
 
-            // Sync all threads in the team so that scratch memory is consistent
-            member.team_barrier();
+                // We template on reconstruction type to avoid a big switch statement here.
+                // Instead, a version of GetFlux() is generated separately for each reconstruction/direction pair.
+                // See reconstruction.hpp for all the implementations.
+                KReconstruction::ReconstructRowTiled<Recon, dir>(member, P_all(bl), k, j, b.is, b.ie, Pl_s, Pr_s,
+                                                                 tile_s, r, tiled, hybrid_threshold);
 
-            parthenon::par_for_inner(member, b.is, b.ie,
-                [&](const int& i) {
-                    auto Pl = Kokkos::subview(Pl_s, Kokkos::ALL(), i);
-                    auto Pr = Kokkos::subview(Pr_s, Kokkos::ALL(), i);
-                    // Apply floors to the *reconstructed* primitives, because without TVD
-                    // we have no guarantee they remotely resemble the *centered* primitives
-                    // If we selected to fall back to TVD, the floors are at zero (as intended)
-                    if (reconstruction_floors || reconstruction_fallback) {
-                        fallback_tvd(i)  = Floors::apply_geo_floors(G, Pl, m_p, gam, j, i, floors, loc);
-                        fallback_tvd(i) |= Floors::apply_geo_floors(G, Pr, m_p, gam, j, i, floors, loc);
+                // Sync all threads in the team so that scratch memory is consistent
+                member.team_barrier();
+
+                parthenon::par_for_inner(member, b.is, b.ie,
+                    [&](const int& i) {
+                        auto Pl = Kokkos::subview(Pl_s, Kokkos::ALL(), i);
+                        auto Pr = Kokkos::subview(Pr_s, Kokkos::ALL(), i);
+                        // Apply floors to the *reconstructed* primitives, because without TVD
+                        // we have no guarantee they remotely resemble the *centered* primitives
+                        // If we selected to fall back to TVD, the floors are at zero (as intended)
+                        if (reconstruction_floors || reconstruction_fallback) {
+                            fallback_tvd(i)  = Floors::apply_geo_floors(G, Pl, m_p, gam, j, i, floors, loc);
+                            fallback_tvd(i) |= Floors::apply_geo_floors(G, Pr, m_p, gam, j, i, floors, loc);
+                        }
                     }
+                );
+                member.team_barrier();
+
+                if (reconstruction_fallback) {
+                    // TODO option of scheme?
+                    KReconstruction::ReconstructFlaggedFaces<RType::ppm, dir>(member, P_all(bl), k, j, b.is, b.ie,
+                                                                              fallback_tvd, fallback_list, Pl_s, Pr_s);
+                    member.team_barrier();
                 }
-            );
-            member.team_barrier();
 
-            if (reconstruction_fallback) {
-                // TODO without the whole thing again? Also, option of scheme?
-                KReconstruction::ReconstructRow<RType::ppm, dir>(member, P_all(bl), k, j, b.is, b.ie, Plf_s, Prf_s);
-                member.team_barrier();
-                for (int p = 0; p <= P_all.GetDim(4) - 1; ++p) {
+                // Copy out state (TODO(BSP) eliminate)
+                for (int p=0; p < nvar; ++p) {
                     parthenon::par_for_inner(member, b.is, b.ie,
                         [&](const int& i) {
-                            if (fallback_tvd(i)) {
-                                Pl_s(p, i) = Plf_s(p, i);
-                                Pr_s(p, i) = Prf_s(p, i);
-                            }
+                            Pl_all(bl, p, k, j, i) = Pl_s(p, i);
+                            Pr_all(bl, p, k, j, i) = Pr_s(p, i);
                         }
                     );
                 }
                 member.team_barrier();
             }
-
-            // Copy out state (TODO(BSP) eliminate)
-            for (int p=0; p < nvar; ++p) {
-                parthenon::par_for_inner(member, b.is, b.ie,
-                    [&](const int& i) {
-                        Pl_all(bl, p, k, j, i) = Pl_s(p, i);
-                        Pr_all(bl, p, k, j, i) = Pr_s(p, i);
-                    }
-                );
-            }
-            member.team_barrier();
         }
     );
     EndFlag();
@@ -260,12 +323,12 @@ inline TaskStatus GetFlux(MeshData<Real> *md)
 
                     // Left
                     GRMHD::calc_4vecs(G, Pl, m_p, j, i, loc, Dtmp);
-                    Flux::prim_to_flux(G, Pl, m_p, Dtmp, emhd_params, gam, j, i, 0, Ul, m_u, loc);
-                    Flux::prim_to_flux(G, Pl, m_p, Dtmp, emhd_params, gam, j, i, dir, Fl, m_u, loc);
+                    Flux::prim_to_flux<Phys>(G, Pl, m_p, Dtmp, emhd_params, gam, j, i, 0, Ul, m_u, loc);
+                    Flux::prim_to_flux<Phys>(G, Pl, m_p, Dtmp, emhd_params, gam, j, i, dir, Fl, m_u, loc);
 
                     // Magnetosonic speeds
                     Real cmaxL, cminL;
-                    Flux::vchar(G, Pl, m_p, Dtmp, gam, emhd_params, k, j, i, loc, dir, cmaxL, cminL);
+                    Flux::vchar<Phys>(G, Pl, m_p, Dtmp, gam, emhd_params, k, j, i, loc, dir, cmaxL, cminL);
 
                     // Record speeds
                     cmax(bl, dir-1, k, j, i) = m::max(0., cmaxL);
@@ -316,12 +379,12 @@ inline TaskStatus GetFlux(MeshData<Real> *md)
                     FourVectors Dtmp;
                     // Right
                     GRMHD::calc_4vecs(G, Pr, m_p, j, i, loc, Dtmp);
-                    Flux::prim_to_flux(G, Pr, m_p, Dtmp, emhd_params, gam, j, i, 0, Ur, m_u, loc);
-                    Flux::prim_to_flux(G, Pr, m_p, Dtmp, emhd_params, gam, j, i, dir, Fr, m_u, loc);
+                    Flux::prim_to_flux<Phys>(G, Pr, m_p, Dtmp, emhd_params, gam, j, i, 0, Ur, m_u, loc);
+                    Flux::prim_to_flux<Phys>(G, Pr, m_p, Dtmp, emhd_params, gam, j, i, dir, Fr, m_u, loc);
 
                     // Magnetosonic speeds
                     Real cmaxR, cminR;
-                    Flux::vchar(G, Pr, m_p, Dtmp, gam, emhd_params, k, j, i, loc, dir, cmaxR, cminR);
+                    Flux::vchar<Phys>(G, Pr, m_p, Dtmp, gam, emhd_params, k, j, i, loc, dir, cmaxR, cminR);
 
                     // Calculate cmax/min based on comparison with cached values
                     cmax(bl, dir-1, k, j, i) =  m::max(cmax(bl, dir-1, k, j, i), cmaxR);
@@ -385,4 +448,464 @@ inline TaskStatus GetFlux(MeshData<Real> *md)
     return TaskStatus::complete;
 }
 
+/**
+ * @brief Fused version of GetFlux: reconstruct a row, find conserved variables, fluxes and signal speeds on
+ * both sides of each face, and apply the Riemann solver, all in one kernel from team scratch.
+ *
+ * Enabled with flux/fused.  This never touches the mesh-sized temporaries Flux.Pl/Pr/Ul/Ur/Fl/Fr
+ * (which are not allocated in this mode unless FOFC needs them), writing only the final fluxes,
+ * Flux.cmax/cmin, and if needed Flux.vl/vr.  Results should be identical to the split version.
+ */
+template <KReconstruction::Type Recon, int dir, PhysicsSet Phys>
+inline TaskStatus GetFluxFused(MeshData<Real> *md)
+{
+    // Pointers
+    auto pmesh = md->GetMeshPointer();
+    auto pmb0  = md->GetBlockData(0)->GetBlockPointer();
+    auto& packages = pmb0->packages;
+    // Exit on trivial operations
+    const int ndim = pmesh->ndim;
+    if (ndim < 3 && dir == X3DIR) return TaskStatus::complete;
+    if (ndim < 2 && dir == X2DIR) return TaskStatus::complete;
+
+    Flag("GetFluxFused_"+std::to_string(dir));
+
+    // Options
+    const auto& pars       = packages.Get("Flux")->AllParams();
+    const auto& mhd_pars   = packages.Get("GRMHD")->AllParams();
+    const auto& globals    = packages.Get("Globals")->AllParams();
+    const bool use_hlle    = pars.Get<bool>("use_hlle");
+
+    const bool reconstruction_floors = pars.Get<bool>("reconstruction_floors");
+    Floors::Prescription floors_temp;
+    if (reconstruction_floors) {
+        floors_temp = packages.Get("Floors")->Param<Floors::Prescription>("prescription");
+    }
+    const Floors::Prescription& floors = floors_temp;
+
+    const bool reconstruction_fallback = pars.Get<bool>("reconstruction_fallback");
+    const bool tile_reconstruction = pars.Get<bool>("tile_reconstruction");
+    const int tile_rows = pars.Get<int>("tile_rows");
+    const Real hybrid_threshold = pars.Get<Real>("hybrid_threshold");
+
+    const Real gam = mhd_pars.Get<Real>("gamma");
+
+    const EMHD::EMHD_parameters& emhd_params = EMHD::GetEMHDParameters(packages);
+
+    const Loci loc = loc_of(dir);
+    const TopologicalElement face = FaceOf(dir);
+
+    // With B_CT, replace the reconstructed normal field with the face value.
+    // Without it, face_b is false and we never access the (empty) Bf pack
+    const bool face_b = (packages.AllPackages().count("B_CT") && pars.Get<bool>("consistent_face_b"));
+    // Save the face velocities for upwinded CT.  Likewise vl/vr are empty if unused
+    const bool store_vel = (packages.AllPackages().count("B_CT") &&
+                            packages.Get("B_CT")->Param<std::string>("ct_scheme") == "gs05_c");
+
+    // Pack variables
+    PackIndexMap prims_map, cons_map;
+    const auto& cmax  = md->PackVariables(std::vector<std::string>{"Flux.cmax"});
+    const auto& cmin  = md->PackVariables(std::vector<std::string>{"Flux.cmin"});
+
+    const auto& P_all = md->PackVariables(std::vector<MetadataFlag>{Metadata::GetUserFlag("Primitive"), Metadata::Cell}, prims_map);
+    const auto& U_all = md->PackVariablesAndFluxes(std::vector<MetadataFlag>{Metadata::Conserved, Metadata::Cell}, cons_map);
+    const VarMap m_u(cons_map, true), m_p(prims_map, false);
+
+    const auto& Bf     = md->PackVariables(std::vector<std::string>{"cons.fB"});
+    const auto& vl_all = md->PackVariables(std::vector<std::string>{"Flux.vl"});
+    const auto& vr_all = md->PackVariables(std::vector<std::string>{"Flux.vr"});
+
+    // Get the domain size
+    // We need fluxes outside the domain for flux-CT and FOFC: one extra zone update on each side
+    const IndexRange3 b = KDomain::GetRange(md, IndexDomain::interior, face, -1, 1);
+    // Face B is only replaced on the interior faces, as in the split version
+    const IndexRange3 bi = KDomain::GetRange(md, IndexDomain::interior, face);
+    // Get other sizes we need
+    const int n1 = pmb0->cellbounds.ncellsi(IndexDomain::entire);
+    const IndexRange block = IndexRange{0, cmax.GetDim(5) - 1};
+    const int nvar = U_all.GetDim(4);
+    const int nprim = P_all.GetDim(4);
+
+    if (globals.Get<int>("verbose") > 2) {
+        std::cout << "Calculating fused fluxes for " << cmax.GetDim(5) << " blocks, "
+                << nvar << " variables (" << nprim << " primitives)" << std::endl;
+    }
+
+    // Rows per team, as in GetFlux
+    using RType = KReconstruction::Type;
+    const bool tiled = KReconstruction::UseTile<Recon, dir>(tile_reconstruction);
+    const int nrows = KReconstruction::TileRows<Recon, dir>(tile_reconstruction, tile_rows);
+    const int ntile = KReconstruction::TileSize<Recon, dir>(tile_reconstruction, nrows);
+    const IndexRange kt = (dir == X3DIR) ? IndexRange{0, ((int) b.ke - (int) b.ks) / nrows} : IndexRange{(int) b.ks, (int) b.ke};
+    const IndexRange jt = (dir == X2DIR) ? IndexRange{0, ((int) b.je - (int) b.js) / nrows} : IndexRange{(int) b.js, (int) b.je};
+
+    // Allocate scratch space
+    const int scratch_level = 1; // 0 is actual scratch (tiny); 1 is HBM
+    const size_t var_size_in_bytes = parthenon::ScratchPad2D<Real>::shmem_size(nvar, n1);
+    const size_t line_size_in_bytes = parthenon::ScratchPad1D<int>::shmem_size(n1);
+    const size_t speed_size_in_bytes = parthenon::ScratchPad1D<Real>::shmem_size(n1);
+    // Everything in GetFlux above, plus conserved variables & fluxes on each side, plus signal speeds
+    const size_t scratch_bytes = (6 + 1*(Recon == RType::donor_cell) +
+                                      5*(Recon == RType::linear_vl)) * var_size_in_bytes +
+                                  2 * line_size_in_bytes + 2 * speed_size_in_bytes +
+                                  parthenon::ScratchPad3D<Real>::shmem_size(nprim, ntile, n1);
+
+    parthenon::par_for_outer(DEFAULT_OUTER_LOOP_PATTERN, "calc_flux_fused", pmb0->exec_space,
+        scratch_bytes, scratch_level, block.s, block.e, kt.s, kt.e, jt.s, jt.e,
+        KOKKOS_LAMBDA(parthenon::team_mbr_t member, const int& bl, const int& kt_, const int& jt_) {
+            const auto& G = U_all.GetCoords(bl);
+            ScratchPad2D<Real> Pl_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad2D<Real> Pr_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad2D<Real> Ul_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad2D<Real> Ur_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad2D<Real> Fl_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad2D<Real> Fr_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad1D<int> fallback_tvd(member.team_scratch(scratch_level), n1);
+            ScratchPad1D<int> fallback_list(member.team_scratch(scratch_level), n1);
+            ScratchPad1D<Real> cmax_s(member.team_scratch(scratch_level), n1);
+            ScratchPad1D<Real> cmin_s(member.team_scratch(scratch_level), n1);
+
+            ScratchPad3D<Real> tile_s(member.team_scratch(scratch_level), nprim, ntile, n1);
+
+            const int k0 = (dir == X3DIR) ? (int) b.ks + kt_ * nrows : kt_;
+            const int j0 = (dir == X2DIR) ? (int) b.js + jt_ * nrows : jt_;
+            const int nr = (dir == X3DIR) ? m::min(nrows, (int) b.ke - k0 + 1) :
+                           ((dir == X2DIR) ? m::min(nrows, (int) b.je - j0 + 1) : 1);
+            if constexpr (dir != X1DIR) {
+                if (tiled) {
+                    KReconstruction::GatherRowTile<dir>(member, P_all(bl), k0, j0, nr, b.is, b.ie, tile_s);
+                    member.team_barrier();
+                }
+            }
+
+            for (int r = 0; r < nr; ++r) {
+                const int k = (dir == X3DIR) ? k0 + r : k0;
+                const int j = (dir == X2DIR) ? j0 + r : j0;
+
+                KReconstruction::ReconstructRowTiled<Recon, dir>(member, P_all(bl), k, j, b.is, b.ie, Pl_s, Pr_s,
+                                                                 tile_s, r, tiled, hybrid_threshold);
+                member.team_barrier();
+
+                // Post-reconstruction floors/fallback flags, as in GetFlux
+                if (reconstruction_floors || reconstruction_fallback) {
+                    parthenon::par_for_inner(member, b.is, b.ie,
+                        [&](const int& i) {
+                            auto Pl = Kokkos::subview(Pl_s, Kokkos::ALL(), i);
+                            auto Pr = Kokkos::subview(Pr_s, Kokkos::ALL(), i);
+                            fallback_tvd(i)  = Floors::apply_geo_floors(G, Pl, m_p, gam, j, i, floors, loc);
+                            fallback_tvd(i) |= Floors::apply_geo_floors(G, Pr, m_p, gam, j, i, floors, loc);
+                        }
+                    );
+                    member.team_barrier();
+                }
+
+                if (reconstruction_fallback) {
+                    KReconstruction::ReconstructFlaggedFaces<RType::ppm, dir>(member, P_all(bl), k, j, b.is, b.ie,
+                                                                              fallback_tvd, fallback_list, Pl_s, Pr_s);
+                    member.team_barrier();
+                }
+
+                // Left and right conserved variables, fluxes, and signal speeds
+                parthenon::par_for_inner(member, b.is, b.ie,
+                    [&](const int& i) {
+                        auto Pl = Kokkos::subview(Pl_s, Kokkos::ALL(), i);
+                        auto Pr = Kokkos::subview(Pr_s, Kokkos::ALL(), i);
+                        auto Ul = Kokkos::subview(Ul_s, Kokkos::ALL(), i);
+                        auto Ur = Kokkos::subview(Ur_s, Kokkos::ALL(), i);
+                        auto Fl = Kokkos::subview(Fl_s, Kokkos::ALL(), i);
+                        auto Fr = Kokkos::subview(Fr_s, Kokkos::ALL(), i);
+
+                        if (face_b && k >= bi.ks && k <= bi.ke && j >= bi.js && j <= bi.je && i >= bi.is && i <= bi.ie) {
+                            const Real bf = Bf(bl, face, 0, k, j, i) / G.gdet(loc, j, i);
+                            Pl(m_p.B1+dir-1) = bf;
+                            Pr(m_p.B1+dir-1) = bf;
+                        }
+
+                        FourVectors Dtmp;
+                        Real cmaxL, cminL, cmaxR, cminR;
+                        // Left
+                        GRMHD::calc_4vecs(G, Pl, m_p, j, i, loc, Dtmp);
+                        Flux::prim_to_flux<Phys>(G, Pl, m_p, Dtmp, emhd_params, gam, j, i, 0, Ul, m_u, loc);
+                        Flux::prim_to_flux<Phys>(G, Pl, m_p, Dtmp, emhd_params, gam, j, i, dir, Fl, m_u, loc);
+                        Flux::vchar<Phys>(G, Pl, m_p, Dtmp, gam, emhd_params, k, j, i, loc, dir, cmaxL, cminL);
+                        // Right
+                        GRMHD::calc_4vecs(G, Pr, m_p, j, i, loc, Dtmp);
+                        Flux::prim_to_flux<Phys>(G, Pr, m_p, Dtmp, emhd_params, gam, j, i, 0, Ur, m_u, loc);
+                        Flux::prim_to_flux<Phys>(G, Pr, m_p, Dtmp, emhd_params, gam, j, i, dir, Fr, m_u, loc);
+                        Flux::vchar<Phys>(G, Pr, m_p, Dtmp, gam, emhd_params, k, j, i, loc, dir, cmaxR, cminR);
+
+                        // Same conventions as the split version: cmin is stored positive
+                        cmax_s(i) =  m::max(m::max(0., cmaxL), cmaxR);
+                        cmin_s(i) = -m::min(m::min(0., cminL), cminR);
+                        cmax(bl, dir-1, k, j, i) = cmax_s(i);
+                        cmin(bl, dir-1, k, j, i) = cmin_s(i);
+
+                        if (store_vel) {
+                            VLOOP {
+                                vl_all(bl, face, v, k, j, i) = Pl(m_p.U1+v);
+                                vr_all(bl, face, v, k, j, i) = Pr(m_p.U1+v);
+                            }
+                        }
+                    }
+                );
+                member.team_barrier();
+
+                // Riemann solve straight from scratch into the final fluxes
+                for (int p = 0; p < nvar; ++p) {
+                    if (use_hlle) {
+                        parthenon::par_for_inner(member, b.is, b.ie,
+                            [&](const int& i) {
+                                U_all(bl).flux(dir, p, k, j, i) = hlle(Fl_s(p, i), Fr_s(p, i), cmax_s(i), cmin_s(i),
+                                                                       Ul_s(p, i), Ur_s(p, i));
+                            }
+                        );
+                    } else {
+                        parthenon::par_for_inner(member, b.is, b.ie,
+                            [&](const int& i) {
+                                U_all(bl).flux(dir, p, k, j, i) = llf(Fl_s(p, i), Fr_s(p, i), cmax_s(i), cmin_s(i),
+                                                                      Ul_s(p, i), Ur_s(p, i));
+                            }
+                        );
+                    }
+                }
+                // Scratch is reused by the next row
+                member.team_barrier();
+            }
+        }
+    );
+
+    EndFlag();
+    return TaskStatus::complete;
+}
+
+/**
+ * @brief Multi-direction version of GetFluxFused: each team gathers a block of rows (k, j) and their
+ * stencils into one scratch tile, and computes the fluxes through the X1, X2 and X3 faces of every row
+ * in the block from it, rather than making one full pass over the primitives per direction.
+ *
+ * Enabled with flux/multi_direction, for schemes implemented by single-zone reconstructions (see TileSupported).
+ * The block is flux/multi_direction_tile rows on a side.  Meant to cut memory traffic on CPUs,
+ * but not yet timed against the fused version.  Results should be identical to the fused version.
+ */
+template <KReconstruction::Type Recon, PhysicsSet Phys>
+inline TaskStatus GetFluxMultiDir(MeshData<Real> *md)
+{
+    // Pointers
+    auto pmesh = md->GetMeshPointer();
+    auto pmb0  = md->GetBlockData(0)->GetBlockPointer();
+    auto& packages = pmb0->packages;
+    const int ndim = pmesh->ndim;
+
+    Flag("GetFluxMultiDir");
+
+    // Options
+    const auto& pars       = packages.Get("Flux")->AllParams();
+    const auto& mhd_pars   = packages.Get("GRMHD")->AllParams();
+    const auto& globals    = packages.Get("Globals")->AllParams();
+    const bool use_hlle    = pars.Get<bool>("use_hlle");
+
+    const bool reconstruction_floors = pars.Get<bool>("reconstruction_floors");
+    Floors::Prescription floors_temp;
+    if (reconstruction_floors) {
+        floors_temp = packages.Get("Floors")->Param<Floors::Prescription>("prescription");
+    }
+    const Floors::Prescription& floors = floors_temp;
+
+    const bool reconstruction_fallback = pars.Get<bool>("reconstruction_fallback");
+    const Real hybrid_threshold = pars.Get<Real>("hybrid_threshold");
+    const int tile = pars.Get<int>("multi_direction_tile");
+
+    const Real gam = mhd_pars.Get<Real>("gamma");
+
+    const EMHD::EMHD_parameters& emhd_params = EMHD::GetEMHDParameters(packages);
+
+    // As in GetFluxFused
+    const bool face_b = (packages.AllPackages().count("B_CT") && pars.Get<bool>("consistent_face_b"));
+    const bool store_vel = (packages.AllPackages().count("B_CT") &&
+                            packages.Get("B_CT")->Param<std::string>("ct_scheme") == "gs05_c");
+
+    // Pack variables
+    PackIndexMap prims_map, cons_map;
+    const auto& cmax  = md->PackVariables(std::vector<std::string>{"Flux.cmax"});
+    const auto& cmin  = md->PackVariables(std::vector<std::string>{"Flux.cmin"});
+
+    const auto& P_all = md->PackVariables(std::vector<MetadataFlag>{Metadata::GetUserFlag("Primitive"), Metadata::Cell}, prims_map);
+    const auto& U_all = md->PackVariablesAndFluxes(std::vector<MetadataFlag>{Metadata::Conserved, Metadata::Cell}, cons_map);
+    const VarMap m_u(cons_map, true), m_p(prims_map, false);
+
+    const auto& Bf     = md->PackVariables(std::vector<std::string>{"cons.fB"});
+    const auto& vl_all = md->PackVariables(std::vector<std::string>{"Flux.vl"});
+    const auto& vr_all = md->PackVariables(std::vector<std::string>{"Flux.vr"});
+
+    // Face ranges for each direction, as in GetFlux, and the interior faces for replacing B
+    const IndexRange3 b1 = KDomain::GetRange(md, IndexDomain::interior, F1, -1, 1);
+    const IndexRange3 b2 = (ndim > 1) ? KDomain::GetRange(md, IndexDomain::interior, F2, -1, 1) : b1;
+    const IndexRange3 b3 = (ndim > 2) ? KDomain::GetRange(md, IndexDomain::interior, F3, -1, 1) : b1;
+    const IndexRange3 bi1 = KDomain::GetRange(md, IndexDomain::interior, F1);
+    const IndexRange3 bi2 = KDomain::GetRange(md, IndexDomain::interior, F2);
+    const IndexRange3 bi3 = KDomain::GetRange(md, IndexDomain::interior, F3);
+    // Every row with a face in any direction, split into blocks of tk x tj rows
+    const IndexRange jb = IndexRange{(int) b2.js, (int) b2.je};
+    const IndexRange kb = IndexRange{(int) b3.ks, (int) b3.ke};
+    const int tk = (ndim > 2) ? tile : 1;
+    const int tj = (ndim > 1) ? tile : 1;
+    const IndexRange kt = IndexRange{0, (kb.e - kb.s) / tk};
+    const IndexRange jt = IndexRange{0, (jb.e - jb.s) / tj};
+    const int ntile = KReconstruction::BlockTileSize(tk, ndim > 2) * KReconstruction::BlockTileSize(tj, ndim > 1);
+    // Get other sizes we need
+    const int n1 = pmb0->cellbounds.ncellsi(IndexDomain::entire);
+    const IndexRange block = IndexRange{0, cmax.GetDim(5) - 1};
+    const int nvar = U_all.GetDim(4);
+    const int nprim = P_all.GetDim(4);
+
+    if (globals.Get<int>("verbose") > 2) {
+        std::cout << "Calculating fluxes in all directions for " << cmax.GetDim(5) << " blocks, "
+                << nvar << " variables (" << nprim << " primitives)" << std::endl;
+    }
+
+    // Allocate scratch space: the primitive tile, plus everything in GetFluxFused for one direction at a time
+    const int scratch_level = 1; // 0 is actual scratch (tiny); 1 is HBM
+    const size_t var_size_in_bytes = parthenon::ScratchPad2D<Real>::shmem_size(nvar, n1);
+    const size_t line_size_in_bytes = parthenon::ScratchPad1D<int>::shmem_size(n1);
+    const size_t speed_size_in_bytes = parthenon::ScratchPad1D<Real>::shmem_size(n1);
+    const size_t scratch_bytes = parthenon::ScratchPad3D<Real>::shmem_size(nprim, ntile, n1) +
+                                 6 * var_size_in_bytes + 2 * line_size_in_bytes + 2 * speed_size_in_bytes;
+
+    parthenon::par_for_outer(DEFAULT_OUTER_LOOP_PATTERN, "calc_flux_multidir", pmb0->exec_space,
+        scratch_bytes, scratch_level, block.s, block.e, kt.s, kt.e, jt.s, jt.e,
+        KOKKOS_LAMBDA(parthenon::team_mbr_t member, const int& bl, const int& kt_, const int& jt_) {
+            const auto& G = U_all.GetCoords(bl);
+            ScratchPad3D<Real> q_s(member.team_scratch(scratch_level), nprim, ntile, n1);
+            ScratchPad2D<Real> Pl_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad2D<Real> Pr_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad2D<Real> Ul_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad2D<Real> Ur_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad2D<Real> Fl_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad2D<Real> Fr_s(member.team_scratch(scratch_level), nvar, n1);
+            ScratchPad1D<int> fallback_tvd(member.team_scratch(scratch_level), n1);
+            ScratchPad1D<int> fallback_list(member.team_scratch(scratch_level), n1);
+            ScratchPad1D<Real> cmax_s(member.team_scratch(scratch_level), n1);
+            ScratchPad1D<Real> cmin_s(member.team_scratch(scratch_level), n1);
+
+            // This team's block of rows, and the tile coordinates of its first row
+            const int k0 = kb.s + kt_ * tk;
+            const int j0 = jb.s + jt_ * tj;
+            const int nk = m::min(tk, kb.e - k0 + 1);
+            const int nj = m::min(tj, jb.e - j0 + 1);
+            const int hk = KReconstruction::BlockTileHalo(ndim > 2);
+            const int hj = KReconstruction::BlockTileHalo(ndim > 1);
+            const int NJ = KReconstruction::BlockTileSize(nj, ndim > 1);
+
+            KReconstruction::GatherBlockTile(member, P_all(bl), k0, j0, nk, nj, ndim, q_s);
+            member.team_barrier();
+
+            // Everything after reconstruction is exactly GetFluxFused, for each direction in turn
+            auto row_flux = [&](auto dir_c, const int& k, const int& j) {
+                constexpr int dir = decltype(dir_c)::value;
+                const IndexRange3& b  = (dir == X1DIR) ? b1 : ((dir == X2DIR) ? b2 : b3);
+                const IndexRange3& bi = (dir == X1DIR) ? bi1 : ((dir == X2DIR) ? bi2 : bi3);
+                if (k < b.ks || k > b.ke || j < b.js || j > b.je) return;
+                const Loci loc = loc_of(dir);
+                const TopologicalElement face = FaceOf(dir);
+
+                KReconstruction::ReconstructFromBlockTile<Recon, dir>(member, q_s, hk + k - k0, hj + j - j0, NJ,
+                                                                      nprim, b.is, b.ie, Pl_s, Pr_s, hybrid_threshold);
+                member.team_barrier();
+
+                if (reconstruction_floors || reconstruction_fallback) {
+                    parthenon::par_for_inner(member, b.is, b.ie,
+                        [&](const int& i) {
+                            auto Pl = Kokkos::subview(Pl_s, Kokkos::ALL(), i);
+                            auto Pr = Kokkos::subview(Pr_s, Kokkos::ALL(), i);
+                            fallback_tvd(i)  = Floors::apply_geo_floors(G, Pl, m_p, gam, j, i, floors, loc);
+                            fallback_tvd(i) |= Floors::apply_geo_floors(G, Pr, m_p, gam, j, i, floors, loc);
+                        }
+                    );
+                    member.team_barrier();
+                }
+
+                if (reconstruction_fallback) {
+                    KReconstruction::ReconstructFlaggedFaces<KReconstruction::Type::ppm, dir>(member, P_all(bl), k, j, b.is, b.ie,
+                                                                                              fallback_tvd, fallback_list, Pl_s, Pr_s);
+                    member.team_barrier();
+                }
+
+                parthenon::par_for_inner(member, b.is, b.ie,
+                    [&](const int& i) {
+                        auto Pl = Kokkos::subview(Pl_s, Kokkos::ALL(), i);
+                        auto Pr = Kokkos::subview(Pr_s, Kokkos::ALL(), i);
+                        auto Ul = Kokkos::subview(Ul_s, Kokkos::ALL(), i);
+                        auto Ur = Kokkos::subview(Ur_s, Kokkos::ALL(), i);
+                        auto Fl = Kokkos::subview(Fl_s, Kokkos::ALL(), i);
+                        auto Fr = Kokkos::subview(Fr_s, Kokkos::ALL(), i);
+
+                        if (face_b && k >= bi.ks && k <= bi.ke && j >= bi.js && j <= bi.je && i >= bi.is && i <= bi.ie) {
+                            const Real bf = Bf(bl, face, 0, k, j, i) / G.gdet(loc, j, i);
+                            Pl(m_p.B1+dir-1) = bf;
+                            Pr(m_p.B1+dir-1) = bf;
+                        }
+
+                        FourVectors Dtmp;
+                        Real cmaxL, cminL, cmaxR, cminR;
+                        // Left
+                        GRMHD::calc_4vecs(G, Pl, m_p, j, i, loc, Dtmp);
+                        Flux::prim_to_flux<Phys>(G, Pl, m_p, Dtmp, emhd_params, gam, j, i, 0, Ul, m_u, loc);
+                        Flux::prim_to_flux<Phys>(G, Pl, m_p, Dtmp, emhd_params, gam, j, i, dir, Fl, m_u, loc);
+                        Flux::vchar<Phys>(G, Pl, m_p, Dtmp, gam, emhd_params, k, j, i, loc, dir, cmaxL, cminL);
+                        // Right
+                        GRMHD::calc_4vecs(G, Pr, m_p, j, i, loc, Dtmp);
+                        Flux::prim_to_flux<Phys>(G, Pr, m_p, Dtmp, emhd_params, gam, j, i, 0, Ur, m_u, loc);
+                        Flux::prim_to_flux<Phys>(G, Pr, m_p, Dtmp, emhd_params, gam, j, i, dir, Fr, m_u, loc);
+                        Flux::vchar<Phys>(G, Pr, m_p, Dtmp, gam, emhd_params, k, j, i, loc, dir, cmaxR, cminR);
+
+                        cmax_s(i) =  m::max(m::max(0., cmaxL), cmaxR);
+                        cmin_s(i) = -m::min(m::min(0., cminL), cminR);
+                        cmax(bl, dir-1, k, j, i) = cmax_s(i);
+                        cmin(bl, dir-1, k, j, i) = cmin_s(i);
+
+                        if (store_vel) {
+                            VLOOP {
+                                vl_all(bl, face, v, k, j, i) = Pl(m_p.U1+v);
+                                vr_all(bl, face, v, k, j, i) = Pr(m_p.U1+v);
+                            }
+                        }
+                    }
+                );
+                member.team_barrier();
+
+                for (int p = 0; p < nvar; ++p) {
+                    if (use_hlle) {
+                        parthenon::par_for_inner(member, b.is, b.ie,
+                            [&](const int& i) {
+                                U_all(bl).flux(dir, p, k, j, i) = hlle(Fl_s(p, i), Fr_s(p, i), cmax_s(i), cmin_s(i),
+                                                                       Ul_s(p, i), Ur_s(p, i));
+                            }
+                        );
+                    } else {
+                        parthenon::par_for_inner(member, b.is, b.ie,
+                            [&](const int& i) {
+                                U_all(bl).flux(dir, p, k, j, i) = llf(Fl_s(p, i), Fr_s(p, i), cmax_s(i), cmin_s(i),
+                                                                      Ul_s(p, i), Ur_s(p, i));
+                            }
+                        );
+                    }
+                }
+                // Scratch is reused by the next direction
+                member.team_barrier();
+            };
+
+            for (int k = k0; k < k0 + nk; ++k) {
+                for (int j = j0; j < j0 + nj; ++j) {
+                    row_flux(std::integral_constant<int, X1DIR>(), k, j);
+                    if (ndim > 1) row_flux(std::integral_constant<int, X2DIR>(), k, j);
+                    if (ndim > 2) row_flux(std::integral_constant<int, X3DIR>(), k, j);
+                }
+            }
+        }
+    );
+
+    EndFlag();
+    return TaskStatus::complete;
+}
+
 } // Flux
@@ -46,7 +46,7 @@ namespace KReconstruction
 constexpr Real EPS = 1.e-26;
 
 // Enum for all supported reconstruction types.
-enum class Type{donor_cell=0, donor_cell_c, linear_mc, linear_vl, ppm, ppmx, mp5, weno5, weno5_lower_edges, weno5_lower_poles, weno5_linear};
+enum class Type{donor_cell=0, donor_cell_c, linear_mc, linear_vl, ppm, ppmx, mp5, weno5, weno5_lower_edges, weno5_lower_poles, weno5_linear, hybrid};
 
 // Component functions
 KOKKOS_FORCEINLINE_FUNCTION Real mc(const Real dm, const Real dp)
@@ -494,6 +494,68 @@ KOKKOS_INLINE_FUNCTION void reconstruct<Type::ppmx>(const Real &q_im2, const Rea
   }
 }
 
+/**
+ * Hybrid PPM/WENO5 reconstruction
+ * 
+ * Most zones in a torus (disk body, funnel) are smooth and well-resolved, where WENO5's
+ * nonlinear weights cost a lot and buy very little.  This uses a cheap smoothness detector
+ * (largest second difference over the stencil, relative to the local magnitude, as in
+ * Jameson et al. 1981) to pick PPM in smooth zones, and full WENO5 only near steep gradients.
+ * The detector is evaluated per variable and zone, so each face side can differ.
+ * 
+ * Variables passing near zero (e.g. velocities) are always treated as non-smooth,
+ * which just falls back to WENO5.
+ */
+KOKKOS_FORCEINLINE_FUNCTION bool hybrid_is_smooth(const Real& x1, const Real& x2, const Real& x3,
+                                                  const Real& x4, const Real& x5, const Real& threshold)
+{
+    const Real d2 = m::max(m::abs(x1 - 2.*x2 + x3), m::max(m::abs(x2 - 2.*x3 + x4), m::abs(x3 - 2.*x4 + x5)));
+    return d2 < threshold * (m::abs(x2) + 2.*m::abs(x3) + m::abs(x4) + EPS);
+}
+
+/**
+ * Versions taking the smoothness threshold of the hybrid scheme, flux/hybrid_threshold.
+ * Other schemes ignore it & call through.
+ */
+template<Type recon_type>
+KOKKOS_FORCEINLINE_FUNCTION void reconstruct(RECONSTRUCT_ONE_ARGS, const Real& hybrid_threshold)
+{
+    if constexpr (recon_type == Type::hybrid) {
+        if (hybrid_is_smooth(x1, x2, x3, x4, x5, hybrid_threshold)) {
+            reconstruct<Type::ppm>(x1, x2, x3, x4, x5, lout, rout);
+        } else {
+            reconstruct<Type::weno5>(x1, x2, x3, x4, x5, lout, rout);
+        }
+    } else {
+        reconstruct<recon_type>(x1, x2, x3, x4, x5, lout, rout);
+    }
+}
+template<Type recon_type>
+KOKKOS_FORCEINLINE_FUNCTION void reconstruct_left(RECONSTRUCT_ONE_LEFT_ARGS, const Real& hybrid_threshold)
+{
+    if constexpr (recon_type == Type::hybrid) {
+        if (hybrid_is_smooth(x1, x2, x3, x4, x5, hybrid_threshold)) {
+            reconstruct_left<Type::ppm>(x1, x2, x3, x4, x5, lout);
+        } else {
+            reconstruct_left<Type::weno5>(x1, x2, x3, x4, x5, lout);
+        }
+    } else {
+        reconstruct_left<recon_type>(x1, x2, x3, x4, x5, lout);
+    }
+}
+template<Type recon_type>
+KOKKOS_FORCEINLINE_FUNCTION void reconstruct_right(RECONSTRUCT_ONE_RIGHT_ARGS, const Real& hybrid_threshold)
+{
+    if constexpr (recon_type == Type::hybrid) {
+        if (hybrid_is_smooth(x1, x2, x3, x4, x5, hybrid_threshold)) {
+            reconstruct_right<Type::ppm>(x1, x2, x3, x4, x5, rout);
+        } else {
+            reconstruct_right<Type::weno5>(x1, x2, x3, x4, x5, rout);
+        }
+    } else {
+        reconstruct_right<recon_type>(x1, x2, x3, x4, x5, rout);
+    }
+}
 
 // Row-wise implementations
 // Note that "L" and "R" refer to the sides of the *face*
@@ -503,9 +565,10 @@ KOKKOS_INLINE_FUNCTION void reconstruct<Type::ppmx>(const Real &q_im2, const Rea
 // so weirdly, ReconstructX2l calls reconstruct_right.  Get it?
 #define RECONSTRUCT_ROW_INPUT parthenon::team_mbr_t const &member, const int& k, const int& j, \
                               const int& il, const int& iu, const VariablePack<Real> &q,
-#define RECONSTRUCT_ROW_ARGS RECONSTRUCT_ROW_INPUT ScratchPad2D<Real> &ql, ScratchPad2D<Real> &qr
-#define RECONSTRUCT_ROW_LEFT_ARGS RECONSTRUCT_ROW_INPUT ScratchPad2D<Real> &ql
-#define RECONSTRUCT_ROW_RIGHT_ARGS RECONSTRUCT_ROW_INPUT ScratchPad2D<Real> &qr
+#define RECONSTRUCT_ROW_ARGS RECONSTRUCT_ROW_INPUT ScratchPad2D<Real> &ql, ScratchPad2D<Real> &qr, \
+                             const Real& hybrid_threshold = 0.
+#define RECONSTRUCT_ROW_LEFT_ARGS RECONSTRUCT_ROW_INPUT ScratchPad2D<Real> &ql, const Real& hybrid_threshold = 0.
+#define RECONSTRUCT_ROW_RIGHT_ARGS RECONSTRUCT_ROW_INPUT ScratchPad2D<Real> &qr, const Real& hybrid_threshold = 0.
 
 // TODO(BSP) I'm sure these could be shorter with more C++ magic
 template <Type recon_type>
@@ -520,7 +583,7 @@ KOKKOS_INLINE_FUNCTION void ReconstructX1(RECONSTRUCT_ROW_ARGS)
                     q(p, k, j, i),
                     q(p, k, j, i + 1),
                     q(p, k, j, i + 2),
-                    qr(p, i), ql(p, i+1));
+                    qr(p, i), ql(p, i+1), hybrid_threshold);
             }
         );
     }
@@ -537,7 +600,7 @@ KOKKOS_INLINE_FUNCTION void ReconstructX2l(RECONSTRUCT_ROW_LEFT_ARGS)
                     q(p, k, j, i),
                     q(p, k, j + 1, i),
                     q(p, k, j + 2, i),
-                    ql(p, i));
+                    ql(p, i), hybrid_threshold);
             }
         );
     }
@@ -554,7 +617,7 @@ KOKKOS_INLINE_FUNCTION void ReconstructX2r(RECONSTRUCT_ROW_RIGHT_ARGS)
                     q(p, k, j, i),
                     q(p, k, j + 1, i),
                     q(p, k, j + 2, i),
-                    qr(p, i));
+                    qr(p, i), hybrid_threshold);
             }
         );
     }
@@ -571,7 +634,7 @@ KOKKOS_INLINE_FUNCTION void ReconstructX3l(RECONSTRUCT_ROW_LEFT_ARGS)
                     q(p, k, j, i),
                     q(p, k + 1, j, i),
                     q(p, k + 2, j, i),
-                    ql(p, i));
+                    ql(p, i), hybrid_threshold);
             }
         );
     }
@@ -588,12 +651,20 @@ KOKKOS_INLINE_FUNCTION void ReconstructX3r(RECONSTRUCT_ROW_RIGHT_ARGS)
                     q(p, k, j, i),
                     q(p, k + 1, j, i),
                     q(p, k + 2, j, i),
-                    qr(p, i));
+                    qr(p, i), hybrid_threshold);
             }
         );
     }
 }
 
+} // namespace KReconstruction
+
+// Explicitly vectorized WENO5/MP5/PPM rows, when compiled with KHARMA_SIMD_RECONSTRUCTION.
+// Needs everything above, and needs to be included outside the namespace
+#include "reconstruction_simd.hpp"
+
+namespace KReconstruction
+{
 
 /**
  * Templated calls to different reconstruction algorithms
@@ -603,16 +674,22 @@ KOKKOS_INLINE_FUNCTION void ReconstructX3r(RECONSTRUCT_ROW_RIGHT_ARGS)
 template <Type recon_type, int dir>
 KOKKOS_INLINE_FUNCTION void ReconstructRow(parthenon::team_mbr_t& member, const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold = 0.)
 {
+#if USE_SIMD_RECONSTRUCTION
+    if constexpr (KSIMD::Supported<recon_type>()) {
+        ReconstructRowSimd<recon_type, dir>(member, P, k, j, is_l, ie_l, ql, qr);
+        return;
+    }
+#endif
     if constexpr (dir == X1DIR) {
-        ReconstructX1<recon_type>(member, k, j, is_l, ie_l, P, ql, qr);
+        ReconstructX1<recon_type>(member, k, j, is_l, ie_l, P, ql, qr, hybrid_threshold);
     } else if constexpr (dir == X2DIR) {
-        ReconstructX2l<recon_type>(member, k, j - 1, is_l, ie_l, P, ql);
-        ReconstructX2r<recon_type>(member, k, j, is_l, ie_l, P, qr);
+        ReconstructX2l<recon_type>(member, k, j - 1, is_l, ie_l, P, ql, hybrid_threshold);
+        ReconstructX2r<recon_type>(member, k, j, is_l, ie_l, P, qr, hybrid_threshold);
     } else {
-        ReconstructX3l<recon_type>(member, k - 1, j, is_l, ie_l, P, ql);
-        ReconstructX3r<recon_type>(member, k, j, is_l, ie_l, P, qr);
+        ReconstructX3l<recon_type>(member, k - 1, j, is_l, ie_l, P, ql, hybrid_threshold);
+        ReconstructX3r<recon_type>(member, k, j, is_l, ie_l, P, qr, hybrid_threshold);
     }
 }
 
@@ -621,7 +698,7 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::donor_cell, X1DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     DonorCellX1(member, k, j, is_l, ie_l, P, ql, qr);
 }
@@ -629,7 +706,7 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::donor_cell, X2DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     ScratchPad2D<Real> q_u(member.team_scratch(1), P.GetDim(4), P.GetDim(1));
     DonorCellX2(member, k, j - 1, is_l, ie_l, P, ql, q_u);
@@ -639,7 +716,7 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::donor_cell, X3DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     ScratchPad2D<Real> q_u(member.team_scratch(1), P.GetDim(4), P.GetDim(1));
     DonorCellX3(member, k - 1, j, is_l, ie_l, P, ql, q_u);
@@ -651,7 +728,7 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::linear_vl, X1DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     // Extra scratch space for Parthenon's VL limiter stuff
     ScratchPad2D<Real>  qc(member.team_scratch(1), P.GetDim(4), P.GetDim(1));
@@ -664,7 +741,7 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::linear_vl, X2DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     // Extra scratch space for Parthenon's VL limiter stuff
     ScratchPad2D<Real>  qc(member.team_scratch(1), P.GetDim(4), P.GetDim(1));
@@ -679,7 +756,7 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::linear_vl, X3DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     // Extra scratch space for Parthenon's VL limiter stuff
     ScratchPad2D<Real>  qc(member.team_scratch(1), P.GetDim(4), P.GetDim(1));
@@ -697,7 +774,7 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::weno5_lower_edges, X1DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     // This prioiritizes using the same-order fluxes on faces rather than for cells.
     // Neither is transparently wrong (afaict) but this feels nicer
@@ -710,7 +787,7 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::weno5_lower_edges, X2DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     ReconstructRow<Type::weno5, X2DIR>(member, P, k, j, is_l, ie_l, ql, qr);
 }
@@ -718,7 +795,7 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::weno5_lower_edges, X3DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     ReconstructRow<Type::weno5, X3DIR>(member, P, k, j, is_l, ie_l, ql, qr);
 }
@@ -729,7 +806,7 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::weno5_lower_poles, X1DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     ReconstructRow<Type::weno5, X1DIR>(member, P, k, j, is_l, ie_l, ql, qr);
 }
@@ -737,7 +814,7 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::weno5_lower_poles, X2DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     // This prioiritizes using the same fluxes on faces rather than for cells.
     // Neither is transparently wrong (afaict) but this feels nicer
@@ -754,11 +831,247 @@ template <>
 KOKKOS_INLINE_FUNCTION void ReconstructRow<Type::weno5_lower_poles, X3DIR>(parthenon::team_mbr_t& member,
                                         const VariablePack<Real> &P,
                                         const int& k, const int& j, const int& is_l, const int& ie_l, 
-                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
 {
     ReconstructRow<Type::weno5, X3DIR>(member, P, k, j, is_l, ie_l, ql, qr);
 }
 
+/**
+ * Reconstruct both sides of a single face i, for variable p.
+ * Same conventions as the row versions: ql is reconstructed from the zone "left" of the face, qr from the "right"
+ */
+template <Type recon_type, int dir>
+KOKKOS_INLINE_FUNCTION void ReconstructFace(const VariablePack<Real> &P, const int& p,
+                                            const int& k, const int& j, const int& i, Real& ql, Real& qr)
+{
+    if constexpr (dir == X1DIR) {
+        reconstruct_right<recon_type>(P(p, k, j, i - 3), P(p, k, j, i - 2), P(p, k, j, i - 1),
+                                      P(p, k, j, i), P(p, k, j, i + 1), ql);
+        reconstruct_left<recon_type>(P(p, k, j, i - 2), P(p, k, j, i - 1), P(p, k, j, i),
+                                     P(p, k, j, i + 1), P(p, k, j, i + 2), qr);
+    } else if constexpr (dir == X2DIR) {
+        reconstruct_right<recon_type>(P(p, k, j - 3, i), P(p, k, j - 2, i), P(p, k, j - 1, i),
+                                      P(p, k, j, i), P(p, k, j + 1, i), ql);
+        reconstruct_left<recon_type>(P(p, k, j - 2, i), P(p, k, j - 1, i), P(p, k, j, i),
+                                     P(p, k, j + 1, i), P(p, k, j + 2, i), qr);
+    } else {
+        reconstruct_right<recon_type>(P(p, k - 3, j, i), P(p, k - 2, j, i), P(p, k - 1, j, i),
+                                      P(p, k, j, i), P(p, k + 1, j, i), ql);
+        reconstruct_left<recon_type>(P(p, k - 2, j, i), P(p, k - 1, j, i), P(p, k, j, i),
+                                     P(p, k + 1, j, i), P(p, k + 2, j, i), qr);
+    }
+}
+
+/**
+ * Re-reconstruct a row only at the faces marked in 'flags', overwriting ql/qr there.
+ * Used for falling back to a more diffusive scheme where the first one produced unphysical states.
+ * The flagged faces are compacted into 'list' (scratch, at least the length of a row) first,
+ * so a row with no flagged faces costs just the count, and no team barriers.
+ */
+template <Type recon_type, int dir>
+KOKKOS_INLINE_FUNCTION void ReconstructFlaggedFaces(parthenon::team_mbr_t& member, const VariablePack<Real> &P,
+                                        const int& k, const int& j, const int& is_l, const int& ie_l,
+                                        ScratchPad1D<int> flags, ScratchPad1D<int> list,
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+{
+    int nflagged = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(member, is_l, ie_l + 1),
+        [&](const int& i, int& local_count) {
+            local_count += (flags(i) != 0);
+        }
+    , nflagged);
+    if (nflagged == 0) return;
+
+    Kokkos::parallel_scan(Kokkos::TeamThreadRange(member, is_l, ie_l + 1),
+        [&](const int& i, int& offset, const bool& final) {
+            if (flags(i)) {
+                if (final) list(offset) = i;
+                ++offset;
+            }
+        }
+    );
+    member.team_barrier();
+
+    const int nvar = P.GetDim(4);
+    parthenon::par_for_inner(member, 0, nflagged - 1,
+        [&](const int& n) {
+            const int i = list(n);
+            for (int p = 0; p < nvar; ++p) {
+                ReconstructFace<recon_type, dir>(P, p, k, j, i, ql(p, i), qr(p, i));
+            }
+        }
+    );
+}
+
+/**
+ * X2/X3 reconstruction through a contiguous team scratch tile.
+ *
+ * The row versions above read each stencil point straight from the mesh: 5 separate row/plane-strided
+ * streams per face side, and each row is read again for every one of the 6 stencils it is part of.
+ * Instead, a team can reconstruct n consecutive rows in j (for X2) or planes in k (for X3), gathering
+ * the n+5 rows of their stencils once into a tile q_s(p, s, i), then reconstructing each row entirely
+ * from scratch with unit stride in i, as for X1.
+ *
+ * Only supported for schemes implemented by single-zone reconstruct_left/right, see below.
+ */
+template <Type recon_type>
+KOKKOS_FORCEINLINE_FUNCTION constexpr bool TileSupported()
+{
+    return recon_type == Type::donor_cell_c || recon_type == Type::linear_mc ||
+           recon_type == Type::weno5 || recon_type == Type::weno5_linear ||
+           recon_type == Type::ppm || recon_type == Type::mp5 || recon_type == Type::hybrid;
+}
+// Rows of the stencil of one face: the left face state comes from zone j-1 (stencil j-3..j+1),
+// the right from zone j (stencil j-2..j+2)
+#define RECONSTRUCT_TILE_ROWS 6
+
+// Reconstruct faces normal to the tile rows, from the 6 rows s0, s0+ds, ... s0+5*ds
+template <Type recon_type>
+KOKKOS_INLINE_FUNCTION void ReconstructTileRows(parthenon::team_mbr_t& member, const ScratchPad3D<Real>& q_s,
+                                        const int& s0, const int& nvar, const int& is_l, const int& ie_l,
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold,
+                                        const int& ds = 1)
+{
+    for (int p = 0; p < nvar; ++p) {
+        parthenon::par_for_inner(member, is_l, ie_l,
+            KOKKOS_LAMBDA (const int& i) {
+                reconstruct_right<recon_type>(q_s(p, s0, i), q_s(p, s0 + ds, i), q_s(p, s0 + 2*ds, i),
+                                              q_s(p, s0 + 3*ds, i), q_s(p, s0 + 4*ds, i), ql(p, i), hybrid_threshold);
+                reconstruct_left<recon_type>(q_s(p, s0 + ds, i), q_s(p, s0 + 2*ds, i), q_s(p, s0 + 3*ds, i),
+                                             q_s(p, s0 + 4*ds, i), q_s(p, s0 + 5*ds, i), qr(p, i), hybrid_threshold);
+            }
+        );
+    }
+}
+
+/**
+ * Whether to reconstruct through a tile, as requested with flux/tile_reconstruction, and if so
+ * how many rows each team should handle (flux/tile_rows).  Otherwise, teams handle one row each.
+ */
+template <Type recon_type, int dir>
+KOKKOS_FORCEINLINE_FUNCTION constexpr bool UseTile(const bool& tile_reconstruction)
+{
+    return dir != X1DIR && TileSupported<recon_type>() && tile_reconstruction;
+}
+template <Type recon_type, int dir>
+inline int TileRows(const bool& tile_reconstruction, const int& tile_rows)
+{
+    return UseTile<recon_type, dir>(tile_reconstruction) ? tile_rows : 1;
+}
+// Size of the tile for 'nrows' rows, as TileRows() above.  Callers must include this in their scratch request
+template <Type recon_type, int dir>
+inline int TileSize(const bool& tile_reconstruction, const int& nrows)
+{
+    return UseTile<recon_type, dir>(tile_reconstruction) ? nrows + RECONSTRUCT_TILE_ROWS - 1 : 0;
+}
+
+/**
+ * Gather the stencils of the n rows starting at (k0, j0) into q_s: rows j0-3..j0+n+1 of plane k0 for X2,
+ * or planes k0-3..k0+n+1 of row j0 for X3
+ */
+template <int dir>
+KOKKOS_INLINE_FUNCTION void GatherRowTile(parthenon::team_mbr_t& member, const VariablePack<Real> &P,
+                                        const int& k0, const int& j0, const int& n, const int& is_l, const int& ie_l,
+                                        ScratchPad3D<Real> q_s)
+{
+    static_assert(dir != X1DIR, "X1 reconstruction is already unit-stride!");
+    const int nvar = P.GetDim(4);
+    for (int p = 0; p < nvar; ++p) {
+        for (int s = 0; s < n + RECONSTRUCT_TILE_ROWS - 1; ++s) {
+            parthenon::par_for_inner(member, is_l, ie_l,
+                KOKKOS_LAMBDA (const int& i) {
+                    if constexpr (dir == X2DIR) {
+                        q_s(p, s, i) = P(p, k0, j0 - 3 + s, i);
+                    } else {
+                        q_s(p, s, i) = P(p, k0 - 3 + s, j0, i);
+                    }
+                }
+            );
+        }
+    }
+}
+
+/**
+ * Reconstruct row (k, j), the r'th row of a tile gathered by GatherRowTile if 'tiled', otherwise straight
+ * from the mesh as ReconstructRow.  Note 'tiled' should be UseTile() above.
+ */
+template <Type recon_type, int dir>
+KOKKOS_INLINE_FUNCTION void ReconstructRowTiled(parthenon::team_mbr_t& member, const VariablePack<Real> &P,
+                                        const int& k, const int& j, const int& is_l, const int& ie_l,
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr,
+                                        const ScratchPad3D<Real>& q_s, const int& r, const bool& tiled,
+                                        const Real& hybrid_threshold)
+{
+    if constexpr (dir != X1DIR && TileSupported<recon_type>()) {
+        if (tiled) {
+            ReconstructTileRows<recon_type>(member, q_s, r, P.GetDim(4), is_l, ie_l, ql, qr, hybrid_threshold);
+            return;
+        }
+    }
+    ReconstructRow<recon_type, dir>(member, P, k, j, is_l, ie_l, ql, qr, hybrid_threshold);
+}
+
+/**
+ * Block tile for reconstructing all three directions over a block of nk x nj rows starting at (k0, j0),
+ * used by GetFluxMultiDir.  Rows k0-3..k0+nk+1 and j0-3..j0+nj+1 are stored in q_s(p, sk*NJ + sj, i),
+ * with NJ = BlockTileSize(nj, ndim > 1), leaving out the corner rows, which no stencil reads.
+ * Directions beyond ndim have no halo.
+ */
+KOKKOS_FORCEINLINE_FUNCTION int BlockTileHalo(const bool& active)
+{
+    return active ? 3 : 0;
+}
+KOKKOS_FORCEINLINE_FUNCTION int BlockTileSize(const int& n, const bool& active)
+{
+    return active ? n + RECONSTRUCT_TILE_ROWS - 1 : n;
+}
+KOKKOS_INLINE_FUNCTION void GatherBlockTile(parthenon::team_mbr_t& member, const VariablePack<Real> &P,
+                                        const int& k0, const int& j0, const int& nk, const int& nj,
+                                        const int& ndim, ScratchPad3D<Real> q_s)
+{
+    const int nvar = P.GetDim(4);
+    const int n1 = P.GetDim(1);
+    const int hk = BlockTileHalo(ndim > 2), hj = BlockTileHalo(ndim > 1);
+    const int NK = BlockTileSize(nk, ndim > 2), NJ = BlockTileSize(nj, ndim > 1);
+    for (int p = 0; p < nvar; ++p) {
+        for (int sk = 0; sk < NK; ++sk) {
+            for (int sj = 0; sj < NJ; ++sj) {
+                if ((sk < hk || sk >= hk + nk) && (sj < hj || sj >= hj + nj)) continue;
+                parthenon::par_for_inner(member, 0, n1 - 1,
+                    KOKKOS_LAMBDA (const int& i) {
+                        q_s(p, sk*NJ + sj, i) = P(p, k0 - hk + sk, j0 - hj + sj, i);
+                    }
+                );
+            }
+        }
+    }
+}
+// Same conventions as ReconstructRow for the row at (sk, sj) in a tile gathered by GatherBlockTile.
+// Only for TileSupported() schemes
+template <Type recon_type, int dir>
+KOKKOS_INLINE_FUNCTION void ReconstructFromBlockTile(parthenon::team_mbr_t& member, const ScratchPad3D<Real>& q_s,
+                                        const int& sk, const int& sj, const int& NJ,
+                                        const int& nvar, const int& is_l, const int& ie_l,
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr, const Real& hybrid_threshold)
+{
+    static_assert(TileSupported<recon_type>(), "Reconstruction scheme does not support tiles!");
+    if constexpr (dir == X1DIR) {
+        const int s = sk*NJ + sj;
+        for (int p = 0; p < nvar; ++p) {
+            parthenon::par_for_inner(member, is_l, ie_l,
+                KOKKOS_LAMBDA (const int& i) {
+                    reconstruct<recon_type>(q_s(p, s, i - 2), q_s(p, s, i - 1), q_s(p, s, i),
+                                            q_s(p, s, i + 1), q_s(p, s, i + 2), qr(p, i), ql(p, i + 1), hybrid_threshold);
+                }
+            );
+        }
+    } else if constexpr (dir == X2DIR) {
+        ReconstructTileRows<recon_type>(member, q_s, sk*NJ + sj - 3, nvar, is_l, ie_l, ql, qr, hybrid_threshold);
+    } else {
+        ReconstructTileRows<recon_type>(member, q_s, (sk - 3)*NJ + sj, nvar, is_l, ie_l, ql, qr, hybrid_threshold, NJ);
+    }
+}
+
 /**
  * Versions computing just the (limited) slope, for linear reconstructions.
  * Used for gradient calculations needed to implement Extended GRMHD.
@@ -0,0 +1,278 @@
+/*
+ *  File: reconstruction_simd.hpp
+ *
+ *  BSD 3-Clause License
+ *
+ *  Copyright (c) 2020, AFD Group at UIUC
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this
+ *     list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ *  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ *  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ *  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ *  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+/**
+ * Explicitly vectorized versions of the WENO5, MP5 and PPM reconstructions, for CPU builds.
+ *
+ * The single-zone versions in reconstruction.hpp rely on the compiler vectorizing the loop in
+ * par_for_inner, which it usually won't do past the limiter branches.  These are the same
+ * algorithms written branch-free over a generic value type T: limiters become masked selects,
+ * so T can be a Kokkos SIMD vector covering several zones in i.
+ *
+ * Enabled with the CMake option KHARMA_SIMD_RECONSTRUCTION (./make.sh simd).  GPU backends
+ * always use the scalar versions, which are already one zone per thread.
+ *
+ * This file is included partway through reconstruction.hpp, and uses the Type enum and the
+ * single-zone functions from there to handle the row remainders.
+ */
+
+#if SIMD_RECONSTRUCTION && !defined(KOKKOS_ENABLE_CUDA) && !defined(KOKKOS_ENABLE_HIP) && !defined(KOKKOS_ENABLE_SYCL)
+#define USE_SIMD_RECONSTRUCTION 1
+#else
+#define USE_SIMD_RECONSTRUCTION 0
+#endif
+
+#if USE_SIMD_RECONSTRUCTION
+#include <Kokkos_SIMD.hpp>
+
+namespace KReconstruction
+{
+namespace KSIMD
+{
+
+using simd_t = Kokkos::Experimental::native_simd<Real>;
+using mask_t = simd_t::mask_type;
+
+// Masked select, the only operation which differs between scalars and vectors
+KOKKOS_FORCEINLINE_FUNCTION Real select(const bool& mask, const Real& a, const Real& b)
+{
+    return mask ? a : b;
+}
+inline simd_t select(const mask_t& mask, const simd_t& a, const simd_t& b)
+{
+    simd_t out = b;
+    Kokkos::Experimental::where(mask, out) = a;
+    return out;
+}
+
+// Everything else is written in terms of select() and arithmetic
+template<typename T>
+KOKKOS_FORCEINLINE_FUNCTION T vabs(const T& a) { return select(a < T(0.), -a, a); }
+template<typename T>
+KOKKOS_FORCEINLINE_FUNCTION T vmin(const T& a, const T& b) { return select(a < b, a, b); }
+template<typename T>
+KOKKOS_FORCEINLINE_FUNCTION T vmax(const T& a, const T& b) { return select(a > b, a, b); }
+template<typename T>
+KOKKOS_FORCEINLINE_FUNCTION T vminmod(const T& a, const T& b)
+{
+    return select(a * b > T(0.), select(vabs(a) < vabs(b), a, b), T(0.));
+}
+template<typename T>
+KOKKOS_FORCEINLINE_FUNCTION T vmedian(const T& a, const T& b, const T& c)
+{
+    return a + vminmod(b - a, c - a);
+}
+
+// Each scheme only needs the right-side ("rout") version:
+// all are symmetric, so the left side is the same call with the stencil reversed.
+
+// WENO5, see reconstruct<Type::weno5>
+template<typename T>
+KOKKOS_FORCEINLINE_FUNCTION T weno5_right(const T& x1, const T& x2, const T& x3, const T& x4, const T& x5)
+{
+    T c1 = x1 - T(2.)*x2 + x3;
+    T c2 = x1 - T(4.)*x2 + T(3.)*x3;
+    T den0 = T(EPS) + T(13./12.)*c1*c1 + T(1./4.)*c2*c2;
+    c1 = x2 - T(2.)*x3 + x4; c2 = x4 - x2;
+    T den1 = T(EPS) + T(13./12.)*c1*c1 + T(1./4.)*c2*c2;
+    c1 = x3 - T(2.)*x4 + x5; c2 = x5 - T(4.)*x4 + T(3.)*x3;
+    T den2 = T(EPS) + T(13./12.)*c1*c1 + T(1./4.)*c2*c2;
+    den0 *= den0; den1 *= den1; den2 *= den2;
+
+    const T wtr0 = T(1./16.)/den0;
+    const T wtr1 = T(5./8. )/den1;
+    const T wtr2 = T(5./16.)/den2;
+    const T Wr = wtr0 + wtr1 + wtr2;
+
+    return ((T(3./8.)*x1 - T(5./4.)*x2 + T(15./8.)*x3)*(wtr0 / Wr) +
+            (T(-1./8.)*x2 + T(3./4.)*x3 + T(3./8.)*x4)*(wtr1 / Wr) +
+            (T(3./8.)*x3 + T(3./4.)*x4 - T(1./8.)*x5)*(wtr2 / Wr));
+}
+
+// MP5, see mp5_subcalc.  The early return for smooth data becomes the final select
+template<typename T>
+KOKKOS_FORCEINLINE_FUNCTION T mp5_right(const T& Fjm2, const T& Fjm1, const T& Fj, const T& Fjp1, const T& Fjp2)
+{
+    const T alpha = 4.0;
+    const T f = (T(2.0) * Fjm2 - T(13.0) * Fjm1 + T(47.0) * Fj + T(27.0) * Fjp1 - T(3.0) * Fjp2) / T(60.0);
+    const T fMP = Fj + vminmod(Fjp1 - Fj, alpha * (Fj - Fjm1));
+
+    const T d2m = Fjm2 + Fj - T(2.0) * Fjm1;
+    const T d2 = Fjm1 + Fjp1 - T(2.0) * Fj;
+    const T d2p = Fj + Fjp2 - T(2.0) * Fjp1;
+
+    const T dMMp = vminmod(vminmod(T(4.0) * d2 - d2p, T(4.0) * d2p - d2), vminmod(d2, d2p));
+    const T dMMm = vminmod(vminmod(T(4.0) * d2m - d2, T(4.0) * d2 - d2m), vminmod(d2, d2m));
+
+    const T fUL = Fj + alpha * (Fj - Fjm1);
+    const T fAV = T(0.5) * (Fj + Fjp1);
+    const T fMD = fAV - T(0.5) * dMMp;
+    const T fLC = T(0.5) * (T(3.0) * Fj - Fjm1) + T(4.0 / 3.0) * dMMm;
+
+    const T fmin = vmax(vmin(vmin(Fj, Fjp1), fMD), vmin(vmin(Fj, fUL), fLC));
+    const T fmax = vmin(vmax(vmax(Fj, Fjp1), fMD), vmax(vmax(Fj, fUL), fLC));
+
+    return select((f - Fj) * (f - fMP) <= T(1.e-12), f, vmedian(f, fmin, fmax));
+}
+
+// PPM, see reconstruct<Type::ppm>.  Both sides are needed to monotonize either
+template<typename T>
+KOKKOS_FORCEINLINE_FUNCTION void ppm(const T& q_im2, const T& q_im1, const T& q_i, const T& q_ip1, const T& q_ip2,
+                                     T& qlv, T& qrv)
+{
+    qlv = (T(7.)*(q_i + q_im1) - (q_im2 + q_ip1))/T(12.0);
+    qrv = (T(7.)*(q_i + q_ip1) - (q_im1 + q_ip2))/T(12.0);
+
+    qlv = vmax(qlv, vmin(q_i, q_im1));
+    qlv = vmin(qlv, vmax(q_i, q_im1));
+    qrv = vmax(qrv, vmin(q_i, q_ip1));
+    qrv = vmin(qrv, vmax(q_i, q_ip1));
+
+    const T qc = qrv - q_i;
+    const T qd = qlv - q_i;
+    const auto extremum = qc*qd >= T(0.0);
+    qrv = select(extremum, q_i, select(vabs(qc) >= T(2.0)*vabs(qd), q_i - T(2.0)*qd, qrv));
+    qlv = select(extremum, q_i, select(vabs(qd) >= T(2.0)*vabs(qc), q_i - T(2.0)*qc, qlv));
+}
+template<typename T>
+KOKKOS_FORCEINLINE_FUNCTION T ppm_right(const T& x1, const T& x2, const T& x3, const T& x4, const T& x5)
+{
+    T null, rout;
+    ppm(x1, x2, x3, x4, x5, null, rout);
+    return rout;
+}
+
+template<Type recon_type>
+KOKKOS_FORCEINLINE_FUNCTION constexpr bool Supported()
+{
+    return recon_type == Type::weno5 || recon_type == Type::mp5 || recon_type == Type::ppm;
+}
+
+template<Type recon_type>
+KOKKOS_FORCEINLINE_FUNCTION simd_t right(const simd_t& x1, const simd_t& x2, const simd_t& x3, const simd_t& x4, const simd_t& x5)
+{
+    if constexpr (recon_type == Type::weno5) {
+        return weno5_right(x1, x2, x3, x4, x5);
+    } else if constexpr (recon_type == Type::mp5) {
+        return mp5_right(x1, x2, x3, x4, x5);
+    } else {
+        return ppm_right(x1, x2, x3, x4, x5);
+    }
+}
+template<Type recon_type>
+KOKKOS_FORCEINLINE_FUNCTION simd_t left(const simd_t& x1, const simd_t& x2, const simd_t& x3, const simd_t& x4, const simd_t& x5)
+{
+    return right<recon_type>(x5, x4, x3, x2, x1);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION simd_t load(const Real *ptr)
+{
+    simd_t v;
+    v.copy_from(ptr, Kokkos::Experimental::element_aligned_tag());
+    return v;
+}
+KOKKOS_FORCEINLINE_FUNCTION void store(const simd_t& v, Real *ptr)
+{
+    v.copy_to(ptr, Kokkos::Experimental::element_aligned_tag());
+}
+
+} // namespace KSIMD
+
+/**
+ * Row reconstruction in chunks of simd_t::size() zones.  Same conventions as ReconstructRow
+ * (see the row-wise implementations above).  The remainder of each row which doesn't fill a vector
+ * is done with the scalar single-zone versions.
+ */
+template <Type recon_type, int dir>
+KOKKOS_INLINE_FUNCTION void ReconstructRowSimd(parthenon::team_mbr_t& member, const VariablePack<Real> &P,
+                                        const int& k, const int& j, const int& is_l, const int& ie_l,
+                                        ScratchPad2D<Real> ql, ScratchPad2D<Real> qr)
+{
+    using KSIMD::simd_t;
+    using KSIMD::load;
+    using KSIMD::store;
+    constexpr int W = simd_t::size();
+    const int nchunk = (ie_l - is_l + W) / W;
+    for (int p = 0; p < P.GetDim(4); ++p) {
+        parthenon::par_for_inner(member, 0, nchunk - 1,
+            [&](const int& c) {
+                const int i0 = is_l + c * W;
+                if (i0 + W - 1 <= ie_l) {
+                    if constexpr (dir == X1DIR) {
+                        const simd_t x1 = load(&P(p, k, j, i0 - 2)), x2 = load(&P(p, k, j, i0 - 1)),
+                                     x3 = load(&P(p, k, j, i0)),
+                                     x4 = load(&P(p, k, j, i0 + 1)), x5 = load(&P(p, k, j, i0 + 2));
+                        store(KSIMD::left<recon_type>(x1, x2, x3, x4, x5), &qr(p, i0));
+                        store(KSIMD::right<recon_type>(x1, x2, x3, x4, x5), &ql(p, i0 + 1));
+                    } else if constexpr (dir == X2DIR) {
+                        const simd_t x0 = load(&P(p, k, j - 3, i0)),
+                                     x1 = load(&P(p, k, j - 2, i0)), x2 = load(&P(p, k, j - 1, i0)),
+                                     x3 = load(&P(p, k, j, i0)),
+                                     x4 = load(&P(p, k, j + 1, i0)), x5 = load(&P(p, k, j + 2, i0));
+                        store(KSIMD::right<recon_type>(x0, x1, x2, x3, x4), &ql(p, i0));
+                        store(KSIMD::left<recon_type>(x1, x2, x3, x4, x5), &qr(p, i0));
+                    } else {
+                        const simd_t x0 = load(&P(p, k - 3, j, i0)),
+                                     x1 = load(&P(p, k - 2, j, i0)), x2 = load(&P(p, k - 1, j, i0)),
+                                     x3 = load(&P(p, k, j, i0)),
+                                     x4 = load(&P(p, k + 1, j, i0)), x5 = load(&P(p, k + 2, j, i0));
+                        store(KSIMD::right<recon_type>(x0, x1, x2, x3, x4), &ql(p, i0));
+                        store(KSIMD::left<recon_type>(x1, x2, x3, x4, x5), &qr(p, i0));
+                    }
+                } else {
+                    for (int i = i0; i <= ie_l; ++i) {
+                        if constexpr (dir == X1DIR) {
+                            reconstruct<recon_type>(P(p, k, j, i - 2), P(p, k, j, i - 1), P(p, k, j, i),
+                                                    P(p, k, j, i + 1), P(p, k, j, i + 2), qr(p, i), ql(p, i + 1));
+                        } else if constexpr (dir == X2DIR) {
+                            reconstruct_right<recon_type>(P(p, k, j - 3, i), P(p, k, j - 2, i), P(p, k, j - 1, i),
+                                                          P(p, k, j, i), P(p, k, j + 1, i), ql(p, i));
+                            reconstruct_left<recon_type>(P(p, k, j - 2, i), P(p, k, j - 1, i), P(p, k, j, i),
+                                                         P(p, k, j + 1, i), P(p, k, j + 2, i), qr(p, i));
+                        } else {
+                            reconstruct_right<recon_type>(P(p, k - 3, j, i), P(p, k - 2, j, i), P(p, k - 1, j, i),
+                                                          P(p, k, j, i), P(p, k + 1, j, i), ql(p, i));
+                            reconstruct_left<recon_type>(P(p, k - 2, j, i), P(p, k - 1, j, i), P(p, k, j, i),
+                                                         P(p, k + 1, j, i), P(p, k + 2, j, i), qr(p, i));
+                        }
+                    }
+                }
+            }
+        );
+    }
+}
+
+} // namespace KReconstruction
+#endif
@@ -83,12 +83,12 @@ KOKKOS_INLINE_FUNCTION Real lorentz_calc(const GRCoordinates& G, const GridVecto
                                          const Loci loc)
 {
 
-    const Real qsq = G.gcov(loc, j, i, 1, 1) * uvec(V1, k, j, i) * uvec(V1, k, j, i) +
-                    G.gcov(loc, j, i, 2, 2) * uvec(V2, k, j, i) * uvec(V2, k, j, i) +
-                    G.gcov(loc, j, i, 3, 3) * uvec(V3, k, j, i) * uvec(V3, k, j, i) +
-                    2. * (G.gcov(loc, j, i, 1, 2) * uvec(V1, k, j, i) * uvec(V2, k, j, i) +
-                        G.gcov(loc, j, i, 1, 3) * uvec(V1, k, j, i) * uvec(V3, k, j, i) +
-                        G.gcov(loc, j, i, 2, 3) * uvec(V2, k, j, i) * uvec(V3, k, j, i));
+    const Real qsq = G.gamma_cov(loc, j, i, 1, 1) * uvec(V1, k, j, i) * uvec(V1, k, j, i) +
+                    G.gamma_cov(loc, j, i, 2, 2) * uvec(V2, k, j, i) * uvec(V2, k, j, i) +
+                    G.gamma_cov(loc, j, i, 3, 3) * uvec(V3, k, j, i) * uvec(V3, k, j, i) +
+                    2. * (G.gamma_cov(loc, j, i, 1, 2) * uvec(V1, k, j, i) * uvec(V2, k, j, i) +
+                        G.gamma_cov(loc, j, i, 1, 3) * uvec(V1, k, j, i) * uvec(V3, k, j, i) +
+                        G.gamma_cov(loc, j, i, 2, 3) * uvec(V2, k, j, i) * uvec(V3, k, j, i));
 
     return m::sqrt(1. + qsq);
 }
@@ -96,12 +96,12 @@ KOKKOS_INLINE_FUNCTION Real lorentz_calc(const GRCoordinates& G, const Real uv[N
                                          const int& k, const int& j, const int& i,
                                          const Loci loc)
 {
-    const Real qsq = G.gcov(loc, j, i, 1, 1) * uv[V1] * uv[V1] +
-                    G.gcov(loc, j, i, 2, 2) * uv[V2] * uv[V2] +
-                    G.gcov(loc, j, i, 3, 3) * uv[V3] * uv[V3] +
-                    2. * (G.gcov(loc, j, i, 1, 2) * uv[V1] * uv[V2] +
-                        G.gcov(loc, j, i, 1, 3) * uv[V1] * uv[V3] +
-                        G.gcov(loc, j, i, 2, 3) * uv[V2] * uv[V3]);
+    const Real qsq = G.gamma_cov(loc, j, i, 1, 1) * uv[V1] * uv[V1] +
+                    G.gamma_cov(loc, j, i, 2, 2) * uv[V2] * uv[V2] +
+                    G.gamma_cov(loc, j, i, 3, 3) * uv[V3] * uv[V3] +
+                    2. * (G.gamma_cov(loc, j, i, 1, 2) * uv[V1] * uv[V2] +
+                        G.gamma_cov(loc, j, i, 1, 3) * uv[V1] * uv[V3] +
+                        G.gamma_cov(loc, j, i, 2, 3) * uv[V2] * uv[V3]);
 
     return m::sqrt(1. + qsq);
 }
@@ -109,12 +109,12 @@ KOKKOS_INLINE_FUNCTION Real lorentz_calc(const GRCoordinates& G, const Real uv[N
 KOKKOS_INLINE_FUNCTION Real lorentz_calc(const GRCoordinates& G, const VariablePack<Real>& P, const VarMap& m,
                                          const int& k, const int& j, const int& i, const Loci& loc=Loci::center)
 {
-    const Real qsq = G.gcov(loc, j, i, 1, 1) * P(m.U1, k, j, i) * P(m.U1, k, j, i) +
-                    G.gcov(loc, j, i, 2, 2) * P(m.U2, k, j, i) * P(m.U2, k, j, i) +
-                    G.gcov(loc, j, i, 3, 3) * P(m.U3, k, j, i) * P(m.U3, k, j, i) +
-                    2. * (G.gcov(loc, j, i, 1, 2) * P(m.U1, k, j, i) * P(m.U2, k, j, i) +
-                        G.gcov(loc, j, i, 1, 3) * P(m.U1, k, j, i) * P(m.U3, k, j, i) +
-                        G.gcov(loc, j, i, 2, 3) * P(m.U2, k, j, i) * P(m.U3, k, j, i));
+    const Real qsq = G.gamma_cov(loc, j, i, 1, 1) * P(m.U1, k, j, i) * P(m.U1, k, j, i) +
+                    G.gamma_cov(loc, j, i, 2, 2) * P(m.U2, k, j, i) * P(m.U2, k, j, i) +
+                    G.gamma_cov(loc, j, i, 3, 3) * P(m.U3, k, j, i) * P(m.U3, k, j, i) +
+                    2. * (G.gamma_cov(loc, j, i, 1, 2) * P(m.U1, k, j, i) * P(m.U2, k, j, i) +
+                        G.gamma_cov(loc, j, i, 1, 3) * P(m.U1, k, j, i) * P(m.U3, k, j, i) +
+                        G.gamma_cov(loc, j, i, 2, 3) * P(m.U2, k, j, i) * P(m.U3, k, j, i));
 
     return m::sqrt(1. + qsq);
 }
@@ -122,12 +122,12 @@ template <typename Local>
 KOKKOS_INLINE_FUNCTION Real lorentz_calc(const GRCoordinates& G, const Local& P, const VarMap& m,
                                          const int& j, const int& i, const Loci& loc=Loci::center)
 {
-    const Real qsq = G.gcov(loc, j, i, 1, 1) * P(m.U1) * P(m.U1) +
-                    G.gcov(loc, j, i, 2, 2) * P(m.U2) * P(m.U2) +
-                    G.gcov(loc, j, i, 3, 3) * P(m.U3) * P(m.U3) +
-                    2. * (G.gcov(loc, j, i, 1, 2) * P(m.U1) * P(m.U2) +
-                        G.gcov(loc, j, i, 1, 3) * P(m.U1) * P(m.U3) +
-                        G.gcov(loc, j, i, 2, 3) * P(m.U2) * P(m.U3));
+    const Real qsq = G.gamma_cov(loc, j, i, 1, 1) * P(m.U1) * P(m.U1) +
+                    G.gamma_cov(loc, j, i, 2, 2) * P(m.U2) * P(m.U2) +
+                    G.gamma_cov(loc, j, i, 3, 3) * P(m.U3) * P(m.U3) +
+                    2. * (G.gamma_cov(loc, j, i, 1, 2) * P(m.U1) * P(m.U2) +
+                        G.gamma_cov(loc, j, i, 1, 3) * P(m.U1) * P(m.U3) +
+                        G.gamma_cov(loc, j, i, 2, 3) * P(m.U2) * P(m.U3));
 
     return m::sqrt(1. + qsq);
 }
@@ -167,57 +167,57 @@ KOKKOS_INLINE_FUNCTION void calc_4vecs(const GRCoordinates& G, const Real uvec[N
                                       FourVectors& D)
 {
     const Real gamma = lorentz_calc(G, uvec, k, j, i, loc);
-    const Real alpha = 1. / m::sqrt(-G.gcon(loc, j, i, 0, 0));
+    const Real alpha = G.lapse(loc, j, i);
 
     D.ucon[0] = gamma / alpha;
-    VLOOP D.ucon[v+1] = uvec[v] - gamma * alpha * G.gcon(loc, j, i, 0, v+1);
+    VLOOP D.ucon[v+1] = uvec[v] - gamma * G.shift(loc, j, i, v+1) / alpha;
 
-    G.lower(D.ucon, D.ucov, k, j, i, loc);
+    G.lower_3p1(D.ucon, D.ucov, j, i, loc);
 
     // This fn is guaranteed to have B values
     D.bcon[0] = 0;
     VLOOP D.bcon[0]  += B_P[v] * D.ucov[v+1];
     VLOOP D.bcon[v+1] = (B_P[v] + D.bcon[0] * D.ucon[v+1]) / D.ucon[0];
 
-    G.lower(D.bcon, D.bcov, k, j, i, loc);
+    G.lower_3p1(D.bcon, D.bcov, j, i, loc);
 }
 KOKKOS_INLINE_FUNCTION void calc_4vecs(const GRCoordinates& G, const GridVector uvec, const GridVector B_P,
                                       const int& k, const int& j, const int& i, const Loci loc,
                                       FourVectors& D)
 {
     const Real gamma = lorentz_calc(G, uvec, k, j, i, loc);
-    const Real alpha = 1. / m::sqrt(-G.gcon(loc, j, i, 0, 0));
+    const Real alpha = G.lapse(loc, j, i);
 
     D.ucon[0] = gamma / alpha;
-    VLOOP D.ucon[v+1] = uvec(v, k, j, i) - gamma * alpha * G.gcon(loc, j, i, 0, v+1);
+    VLOOP D.ucon[v+1] = uvec(v, k, j, i) - gamma * G.shift(loc, j, i, v+1) / alpha;
 
-    G.lower(D.ucon, D.ucov, k, j, i, loc);
+    G.lower_3p1(D.ucon, D.ucov, j, i, loc);
 
     // This fn is guaranteed to have B values
     D.bcon[0] = 0;
     VLOOP D.bcon[0] += B_P(v, k, j, i) * D.ucov[v+1];
     VLOOP D.bcon[v+1] = (B_P(v, k, j, i) + D.bcon[0] * D.ucon[v+1]) / D.ucon[0];
 
-    G.lower(D.bcon, D.bcov, k, j, i, loc);
+    G.lower_3p1(D.bcon, D.bcov, j, i, loc);
 }
 // Primitive/VarMap versions of calc_4vecs for kernels that use "packed" primitives
 KOKKOS_INLINE_FUNCTION void calc_4vecs(const GRCoordinates& G, const VariablePack<Real>& P, const VarMap& m,
                                       const int& k, const int& j, const int& i, const Loci loc, FourVectors& D)
 {
     const Real gamma = lorentz_calc(G, P, m, k, j, i, loc);
-    const Real alpha = 1. / m::sqrt(-G.gcon(loc, j, i, 0, 0));
+    const Real alpha = G.lapse(loc, j, i);
 
     D.ucon[0] = gamma / alpha;
-    VLOOP D.ucon[v+1] = P(m.U1 + v, k, j, i) - gamma * alpha * G.gcon(loc, j, i, 0, v+1);
+    VLOOP D.ucon[v+1] = P(m.U1 + v, k, j, i) - gamma * G.shift(loc, j, i, v+1) / alpha;
 
-    G.lower(D.ucon, D.ucov, k, j, i, loc);
+    G.lower_3p1(D.ucon, D.ucov, j, i, loc);
 
     if (m.B1 >= 0) {
         D.bcon[0] = 0;
         VLOOP D.bcon[0]  += P(m.B1 + v, k, j, i) * D.ucov[v+1];
         VLOOP D.bcon[v+1] = (P(m.B1 + v, k, j, i) + D.bcon[0] * D.ucon[v+1]) / D.ucon[0];
 
-        G.lower(D.bcon, D.bcov, k, j, i, loc);
+        G.lower_3p1(D.bcon, D.bcov, j, i, loc);
     } else {
         DLOOP1 D.bcon[mu] = D.bcov[mu] = 0.;
     }
@@ -227,19 +227,19 @@ KOKKOS_INLINE_FUNCTION void calc_4vecs(const GRCoordinates& G, const Local& P, c
                                       const int& j, const int& i, const Loci loc, FourVectors& D)
 {
     const Real gamma = lorentz_calc(G, P, m, j, i, loc);
-    const Real alpha = 1. / m::sqrt(-G.gcon(loc, j, i, 0, 0));
+    const Real alpha = G.lapse(loc, j, i);
 
     D.ucon[0] = gamma / alpha;
-    VLOOP D.ucon[v+1] = P(m.U1 + v) - gamma * alpha * G.gcon(loc, j, i, 0, v+1);
+    VLOOP D.ucon[v+1] = P(m.U1 + v) - gamma * G.shift(loc, j, i, v+1) / alpha;
 
-    G.lower(D.ucon, D.ucov, 0, j, i, loc);
+    G.lower_3p1(D.ucon, D.ucov, j, i, loc);
 
     if (m.B1 >= 0) {
         D.bcon[0] = 0;
         VLOOP D.bcon[0] += P(m.B1 + v) * D.ucov[v+1];
         VLOOP D.bcon[v+1] = (P(m.B1 + v) + D.bcon[0] * D.ucon[v+1]) / D.ucon[0];
 
-        G.lower(D.bcon, D.bcov, 0, j, i, loc);
+        G.lower_3p1(D.bcon, D.bcov, j, i, loc);
     } else {
         DLOOP1 D.bcon[mu] = D.bcov[mu] = 0.;
     }
@@ -252,20 +252,20 @@ KOKKOS_INLINE_FUNCTION void calc_ucon(const GRCoordinates &G, const GridVector u
                                       Real ucon[GR_DIM])
 {
     const Real gamma = lorentz_calc(G, uvec, k, j, i, loc);
-    const Real alpha = 1. / m::sqrt(-G.gcon(loc, j, i, 0, 0));
+    const Real alpha = G.lapse(loc, j, i);
 
     ucon[0] = gamma / alpha;
-    VLOOP ucon[v+1] = uvec(v, k, j, i) - gamma * alpha * G.gcon(loc, j, i, 0, v+1);
+    VLOOP ucon[v+1] = uvec(v, k, j, i) - gamma * G.shift(loc, j, i, v+1) / alpha;
 }
 KOKKOS_INLINE_FUNCTION void calc_ucon(const GRCoordinates &G, const Real uvec[NVEC],
                                       const int& k, const int& j, const int& i, const Loci loc,
                                       Real ucon[GR_DIM])
 {
     const Real gamma = lorentz_calc(G, uvec, k, j, i, loc);
-    const Real alpha = 1. / m::sqrt(-G.gcon(loc, j, i, 0, 0));
+    const Real alpha = G.lapse(loc, j, i);
 
     ucon[0] = gamma / alpha;
-    VLOOP ucon[v+1] = uvec[v] - gamma * alpha * G.gcon(loc, j, i, 0, v+1);
+    VLOOP ucon[v+1] = uvec[v] - gamma * G.shift(loc, j, i, v+1) / alpha;
 }
 template<typename Local>
 KOKKOS_INLINE_FUNCTION void calc_ucon(const GRCoordinates& G, const Local& P, const VarMap& m,
@@ -273,10 +273,10 @@ KOKKOS_INLINE_FUNCTION void calc_ucon(const GRCoordinates& G, const Local& P, co
                                       Real ucon[GR_DIM])
 {
     const Real gamma = lorentz_calc(G, P, m, j, i, loc);
-    const Real alpha = 1. / m::sqrt(-G.gcon(loc, j, i, 0, 0));
+    const Real alpha = G.lapse(loc, j, i);
 
     ucon[0] = gamma / alpha;
-    VLOOP ucon[v+1] = P(m.U1 + v) - gamma * alpha * G.gcon(loc, j, i, 0, v+1);
+    VLOOP ucon[v+1] = P(m.U1 + v) - gamma * G.shift(loc, j, i, v+1) / alpha;
 }
 template<typename Global>
 KOKKOS_INLINE_FUNCTION void calc_ucon(const GRCoordinates& G, const Global& P, const VarMap& m,
@@ -284,10 +284,10 @@ KOKKOS_INLINE_FUNCTION void calc_ucon(const GRCoordinates& G, const Global& P, c
                                       Real ucon[GR_DIM])
 {
     const Real gamma = lorentz_calc(G, P, m, k, j, i, loc);
-    const Real alpha = 1. / m::sqrt(-G.gcon(loc, j, i, 0, 0));
+    const Real alpha = G.lapse(loc, j, i);
 
     ucon[0] = gamma / alpha;
-    VLOOP ucon[v+1] = P(m.U1 + v, k, j, i) - gamma * alpha * G.gcon(loc, j, i, 0, v+1);
+    VLOOP ucon[v+1] = P(m.U1 + v, k, j, i) - gamma * G.shift(loc, j, i, v+1) / alpha;
 }
 
 /**
@@ -40,6 +40,54 @@
 
 #define NFVAR_MAX 10
 
+/**
+ * Replace the implicit primitives of a failed zone with the distance-weighted average of its neighbors within 'b'
+ * which didn't fail, or of all of them if they all did
+ */
+KOKKOS_INLINE_FUNCTION void fix_solve_zone(const VariablePack<Real>& P, const VariablePack<Real>& solve_fail,
+                                           const int& nfvar, const IndexRange3& b, const int& flag_verbose,
+                                           const int& k, const int& j, const int& i)
+{
+    //printf("Fixing zone %d %d %d!\n", i, j, k);
+    double wsum = 0., wsum_x = 0.;
+    double sum[NFVAR_MAX] = {0.}, sum_x[NFVAR_MAX] = {0.};
+    // For all neighboring cells...
+    for (int n = -1; n <= 1; n++) {
+        for (int m = -1; m <= 1; m++) {
+            for (int l = -1; l <= 1; l++) {
+                int ii = i + l, jj = j + m, kk = k + n;
+                // If we haven't overstepped array bounds...
+                if (KDomain::inside(kk, jj, ii, b)) {
+                    // Weight by distance
+                    // TODO abs(l) == l*l always?
+                    double w = 1./(m::abs(l) + m::abs(m) + m::abs(n) + 1);
+
+                    // Count only the good cells, if we can
+                    if (!Implicit::failed(solve_fail(0, kk, jj, ii))) {
+                        // Weight by distance.  Note interpolated "fixed" cells stay flagged
+                        wsum += w;
+                        FLOOP sum[ip] += w * P(ip, kk, jj, ii);
+                    }
+                    // Just in case, keep a sum of even the bad ones
+                    wsum_x += w;
+                    FLOOP sum_x[ip] += w * P(ip, kk, jj, ii);
+                }
+            }
+        }
+    }
+
+    if(wsum < 1.e-10) {
+        // TODO probably should crash here.
+#ifndef KOKKOS_ENABLE_SYCL
+        if (flag_verbose >= 3) // && KDomain::inside(k, j, i, kb_b, jb_b, ib_b)) // If an interior zone...
+            printf("No neighbors were available at %d %d %d!\n", i, j, k);
+#endif
+        FLOOP P(ip, k, j, i) = sum_x[ip]/wsum_x;
+    } else {
+        FLOOP P(ip, k, j, i) = sum[ip]/wsum;
+    }
+}
+
 // TODO(BSP) should merge this with FixUtoP by generalizing that
 TaskStatus Implicit::FixSolve(MeshBlockData<Real> *mbd) {
 
@@ -57,7 +105,7 @@ TaskStatus Implicit::FixSolve(MeshBlockData<Real> *mbd) {
     const IndexRange3 b = KDomain::GetRange(mbd, IndexDomain::entire);
     const auto& G = pmb->coords;
 
-    GridScalar solve_fail = mbd->Get("solve_fail").data;
+    auto solve_fail = mbd->PackVariables(std::vector<std::string>{"solve_fail"});
 
     const Real gam    = pmb->packages.Get("GRMHD")->Param<Real>("gamma");
     const int flag_verbose = pmb->packages.Get("Globals")->Param<int>("flag_verbose");
@@ -66,46 +114,8 @@ TaskStatus Implicit::FixSolve(MeshBlockData<Real> *mbd) {
         KOKKOS_LAMBDA (const int& k, const int& j, const int& i) {
             // Fix only bad zones
             // Remember "failed" here has a different implementation
-            if (failed(solve_fail(k, j, i))) {
-                //printf("Fixing zone %d %d %d!\n", i, j, k);
-                double wsum = 0., wsum_x = 0.;
-                double sum[NFVAR_MAX] = {0.}, sum_x[NFVAR_MAX] = {0.};
-                // For all neighboring cells...
-                for (int n = -1; n <= 1; n++) {
-                    for (int m = -1; m <= 1; m++) {
-                        for (int l = -1; l <= 1; l++) {
-                            int ii = i + l, jj = j + m, kk = k + n;
-                            // If we haven't overstepped array bounds...
-                            if (KDomain::inside(kk, jj, ii, b)) {
-                                // Weight by distance
-                                // TODO abs(l) == l*l always?
-                                double w = 1./(m::abs(l) + m::abs(m) + m::abs(n) + 1);
-
-                                // Count only the good cells, if we can
-                                if (!failed(solve_fail(kk, jj, ii))) {
-                                    // Weight by distance.  Note interpolated "fixed" cells stay flagged
-                                    wsum += w;
-                                    FLOOP sum[ip] += w * P(ip, kk, jj, ii);
-                                }
-                                // Just in case, keep a sum of even the bad ones
-                                wsum_x += w;
-                                FLOOP sum_x[ip] += w * P(ip, kk, jj, ii);
-                            }
-                        }
-                    }
-                }
-
-                if(wsum < 1.e-10) {
-                    // TODO probably should crash here.
-#ifndef KOKKOS_ENABLE_SYCL
-                    if (flag_verbose >= 3) // && KDomain::inside(k, j, i, kb_b, jb_b, ib_b)) // If an interior zone...
-                        printf("No neighbors were available at %d %d %d!\n", i, j, k);
-#endif
-                    FLOOP P(ip, k, j, i) = sum_x[ip]/wsum_x;
-                } else {
-                    FLOOP P(ip, k, j, i) = sum[ip]/wsum;
-                }
-            }
+            if (failed(solve_fail(0, k, j, i)))
+                fix_solve_zone(P, solve_fail, nfvar, b, flag_verbose, k, j, i);
         }
     );
 
@@ -122,7 +132,7 @@ TaskStatus Implicit::FixSolve(MeshBlockData<Real> *mbd) {
 
     pmb->par_for("fix_solver_failures_PtoU", b.ks, b.ke, b.js, b.je, b.is, b.ie,
         KOKKOS_LAMBDA (const int& k, const int& j, const int& i) {
-            if (failed(solve_fail(k, j, i)))
+            if (failed(solve_fail(0, k, j, i)))
                 Flux::p_to_u(G, P_all, m_p, emhd_params, gam, k, j, i, U_all, m_u);
         }
     );
@@ -131,3 +141,75 @@ TaskStatus Implicit::FixSolve(MeshBlockData<Real> *mbd) {
     return TaskStatus::complete;
 
 }
+
+TaskStatus Implicit::MeshFixSolve(MeshData<Real> *md)
+{
+    Flag("MeshFixSolve");
+    auto pmb0 = md->GetBlockData(0)->GetBlockPointer();
+    auto &pars = pmb0->packages.Get("Implicit")->AllParams();
+
+    // Step lists the zones it failed in the interior.  Add any failures in ghost zones, which were synced
+    // from neighbors, then fix only the listed zones.
+    // Fall back to sweeping each block if there's no list this cycle or it fills up
+    KDomain::ZoneList* list_cache = KDomain::TakeZoneList(*pars.GetMutable<KDomain::ZoneLists>("fail_lists"), md);
+    auto solve_fail = md->PackVariables(std::vector<std::string>{"solve_fail"});
+    const IndexRange3 be = KDomain::GetRange(md, IndexDomain::entire);
+    const IndexRange3 bi = KDomain::GetRange(md, IndexDomain::interior);
+    const IndexRange block = IndexRange{0, solve_fail.GetDim(5) - 1};
+    int nlist = 0;
+    if (list_cache != nullptr) {
+        const auto list = *list_cache;
+        pmb0->par_for("fix_solver_failures_list_ghosts", block.s, block.e, be.ks, be.ke, be.js, be.je, be.is, be.ie,
+            KOKKOS_LAMBDA (const int& b, const int& k, const int& j, const int& i) {
+                if (!KDomain::inside(k, j, i, bi) && failed(solve_fail(b, 0, k, j, i)))
+                    list.Add(b, k, j, i);
+            }
+        );
+        nlist = list.Size();
+        if (nlist > list.Capacity()) {
+            list_cache->Reset(2 * nlist);
+            list_cache = nullptr;
+        }
+    }
+    if (list_cache == nullptr) {
+        for (int i=0; i < md->NumBlocks(); ++i)
+            FixSolve(md->GetBlockData(i).get());
+        EndFlag();
+        return TaskStatus::complete;
+    }
+    if (nlist == 0) {
+        EndFlag();
+        return TaskStatus::complete;
+    }
+
+    const auto list = *list_cache;
+    auto implicit_vars = Implicit::GetOrderedNames(md->GetBlockData(0).get(), Metadata::GetUserFlag("Primitive"), true);
+    auto P = md->PackVariables(implicit_vars);
+    const int nfvar = P.GetDim(4);
+
+    PackIndexMap prims_map, cons_map;
+    auto P_all = md->PackVariables(std::vector<MetadataFlag>{Metadata::GetUserFlag("Primitive")}, prims_map);
+    auto U_all = md->PackVariables(std::vector<MetadataFlag>{Metadata::Conserved}, cons_map);
+    const VarMap m_u(cons_map, true), m_p(prims_map, false);
+
+    const Real gam = pmb0->packages.Get("GRMHD")->Param<Real>("gamma");
+    const int flag_verbose = pmb0->packages.Get("Globals")->Param<int>("flag_verbose");
+    EMHD_parameters emhd_params = EMHD::GetEMHDParameters(pmb0->packages);
+
+    pmb0->par_for("fix_solver_failures", 0, nlist - 1,
+        KOKKOS_LAMBDA (const int& n) {
+            const int b = list.zones(n, 0), k = list.zones(n, 1), j = list.zones(n, 2), i = list.zones(n, 3);
+            fix_solve_zone(P(b), solve_fail(b), nfvar, be, flag_verbose, k, j, i);
+        }
+    );
+    pmb0->par_for("fix_solver_failures_PtoU", 0, nlist - 1,
+        KOKKOS_LAMBDA (const int& n) {
+            const int b = list.zones(n, 0), k = list.zones(n, 1), j = list.zones(n, 2), i = list.zones(n, 3);
+            const auto& G = U_all.GetCoords(b);
+            Flux::p_to_u(G, P_all(b), m_p, emhd_params, gam, k, j, i, U_all(b), m_u);
+        }
+    );
+
+    EndFlag();
+    return TaskStatus::complete;
+}
@@ -34,6 +34,7 @@
 
 #include "implicit.hpp"
 
+#include "domain.hpp"
 #include "grmhd.hpp"
 #include "grmhd_functions.hpp"
 #include "kharma.hpp"
@@ -119,6 +120,8 @@ std::shared_ptr<KHARMAPackage> Implicit::Initialize(ParameterInput *pin, std::sh
     // Integer field that saves where the solver fails (rho + drho < 0 || u + du < 0)
     m_real = Metadata({Metadata::Real, Metadata::Cell, Metadata::Derived, Metadata::OneCopy, Metadata::FillGhost});
     pkg->AddField("solve_fail", m_real); // TODO: Replace with m_int once Integer is supported for CellVariable
+    // Zones which failed in the last Step, for FixSolve, one list per MeshData partition
+    params.Add("fail_lists", KDomain::ZoneLists(), true);
 
     // Should the solve save the residual vector field? Useful for debugging purposes. Default is NO.
     bool save_residual = pin->GetOrAddBoolean("implicit", "save_residual", false);
@@ -233,6 +236,10 @@ TaskStatus Implicit::Step(MeshData<Real> *md_full_step_init, MeshData<Real> *md_
     // std::cerr << "Solve size " << nfvar << " on prim size " << nvar << std::endl;
     if (nfvar == 0) return TaskStatus::complete;
 
+    // List zones as they fail, so FixSolve needn't search for them
+    auto& implicit_mutable_par = pmb_full_step_init->packages.Get("Implicit")->AllParams();
+    const auto fail_list = KDomain::StartZoneList(*implicit_mutable_par.GetMutable<KDomain::ZoneLists>("fail_lists"), md_solver);
+
     // The norm of the residual.  We store this to avoid the main kernel
     // also being a 2-stage reduction, which is complex and sucks.
     // TODO keep this around as a field?
@@ -483,6 +490,7 @@ TaskStatus Implicit::Step(MeshData<Real> *md_full_step_init, MeshData<Real> *md_
                             }
                             if ((P_solver(m_p.RHO) + lambda*delta_prim(m_p.RHO) < 0.) || (P_solver(m_p.UU) + lambda*delta_prim(m_p.UU) < 0.)) {
                                 solve_fail() = SolverStatus::fail;
+                                fail_list.Add(b, k, j, i);
                                 // break; // Doesn't break from the inner par_for. 
                                 // Instead we set all fluid primitives to value at beginning of substep.
                                 // We average over neighboring good zones later.
@@ -541,6 +549,7 @@ TaskStatus Implicit::Step(MeshData<Real> *md_full_step_init, MeshData<Real> *md_
                                 if (isnan(solve_norm())) {
                                     // Unrecoverable
                                     solve_fail() = SolverStatus::fail;
+                                    fail_list.Add(b, k, j, i);
                                     FLOOP P_solver(ip) = P_sub_step_init(ip);
                                 } else if (solve_norm() > rootfind_tol) {
                                     solve_fail() = SolverStatus::beyond_tol; // TODO was changed from +=. Valid?
@@ -111,13 +111,11 @@ std::vector<std::string> GetOrderedNames(MeshBlockData<Real> *rc, const Metadata
  * @return TaskStatus 
  */
 TaskStatus FixSolve(MeshBlockData<Real> *mbd);
-inline TaskStatus MeshFixSolve(MeshData<Real> *md) {
-    Flag("MeshFixSolve");
-    for (int i=0; i < md->NumBlocks(); ++i)
-        FixSolve(md->GetBlockData(i).get());
-    EndFlag();
-    return TaskStatus::complete;
-}
+/**
+ * As FixSolve, over all blocks of 'md'.  Visits only the zones Step listed as failed this cycle,
+ * plus any failed ghost zones, falling back to FixSolve on each block if there is no such list
+ */
+TaskStatus MeshFixSolve(MeshData<Real> *md);
 
 /**
  * Print diagnostics about number of failed solves
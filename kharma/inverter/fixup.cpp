@@ -44,6 +44,58 @@
 #define NPRIM 5
 #define PRIMLOOP for(int p=0; p < NPRIM; ++p)
 
+/**
+ * Replace the primitives of a failed zone with the distance-weighted average of its good neighbors within 'b',
+ * or zeros to be filled by floors if there are none (or averaging is disabled)
+ */
+KOKKOS_INLINE_FUNCTION void fix_zone(const VariablePack<Real>& P, const VariablePack<Real>& pflag, const bool& fix_average,
+                                     const IndexRange3& b, const int& k, const int& j, const int& i)
+{
+    double wsum = 0.;
+    double sum[NPRIM] = {0.};
+    if (fix_average) {
+        // Luckily fixups are rare, so we don't have to worry about optimizing this *too* much
+        // For all neighboring cells...
+        for (int n = -1; n <= 1; n++) {
+            for (int m = -1; m <= 1; m++) {
+                for (int l = -1; l <= 1; l++) {
+                    int ii = i + l, jj = j + m, kk = k + n;
+                    // If we haven't overstepped array bounds...
+                    if (KDomain::inside(kk, jj, ii, b)) {
+                        // Count only the good cells (not failed AND not corner), if we can
+                        // Note interpolated "fixed" cells stay flagged
+                        if (!Inverter::failed(pflag(0, kk, jj, ii))) {
+                            // Weight by distance
+                            double w = 1./(m::abs(l) + m::abs(m) + m::abs(n) + 1);
+                            wsum += w;
+                            PRIMLOOP sum[p] += w * P(p, kk, jj, ii);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Set to atmosphere/floors, zero velocity
+    // Fallback fix if we're averaging, only fix if not
+    if(wsum < 1.e-10) {
+        // We fill this with floor values below
+        PRIMLOOP P(p, k, j, i) = 0.;
+    } else {
+        PRIMLOOP P(p, k, j, i) = sum[p]/wsum;
+    }
+}
+
+/**
+ * Floors to use on fixed zones: those from the floors package if it's enabled, otherwise any we've been asked to apply
+ */
+inline Floors::Prescription fix_floors(Packages_t& packages)
+{
+    return packages.AllPackages().count("Floors") ?
+            packages.Get("Floors")->Param<Floors::Prescription>("prescription") :
+            packages.Get("Inverter")->Param<Floors::Prescription>("inverter_prescription");
+}
+
 TaskStatus Inverter::FixUtoP(MeshBlockData<Real> *rc)
 {
     // We expect primitives all the way out to 3 ghost zones on all sides.
@@ -60,14 +112,11 @@ TaskStatus Inverter::FixUtoP(MeshBlockData<Real> *rc)
     // Only fixup the core 5 prims TODO build by flag, HD + anything implicit
     auto P = GRMHD::PackHDPrims(rc);
 
-    GridScalar pflag = rc->Get("pflag").data;
+    auto pflag = rc->PackVariables(std::vector<std::string>{"pflag"});
 
     const auto& pars = pmb->packages.Get("GRMHD")->AllParams();
     const Real gam = pars.Get<Real>("gamma");
 
-    // Only yell about neighbors on extreme verbosity.
-    const int flag_verbose = pmb->packages.Get("Globals")->Param<int>("flag_verbose");
-
     // UtoP is applied and fixed over all "Physical" zones -- anything in the domain,
     // OR in an MPI boundary.  This is because it is applied *after* the MPI sync,
     // but before physical boundary zones are computed (which it should never use anyway)
@@ -78,49 +127,13 @@ TaskStatus Inverter::FixUtoP(MeshBlockData<Real> *rc)
 
     pmb->par_for("fix_U_to_P", b.ks, b.ke, b.js, b.je, b.is, b.ie,
         KOKKOS_LAMBDA (const int &k, const int &j, const int &i) {
-            if (failed(pflag(k, j, i))) {
-                double wsum = 0.;
-                double sum[NPRIM] = {0.};
-                if (fix_average) {
-                    // Luckily fixups are rare, so we don't have to worry about optimizing this *too* much
-                    // For all neighboring cells...
-                    for (int n = -1; n <= 1; n++) {
-                        for (int m = -1; m <= 1; m++) {
-                            for (int l = -1; l <= 1; l++) {
-                                int ii = i + l, jj = j + m, kk = k + n;
-                                // If we haven't overstepped array bounds...
-                                if (KDomain::inside(kk, jj, ii, b)) {
-                                    // Count only the good cells (not failed AND not corner), if we can
-                                    // Note interpolated "fixed" cells stay flagged
-                                    if (!failed(pflag(kk, jj, ii))) {
-                                        // Weight by distance
-                                        double w = 1./(m::abs(l) + m::abs(m) + m::abs(n) + 1);
-                                        wsum += w;
-                                        PRIMLOOP sum[p] += w * P(p, kk, jj, ii);
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-
-                // Set to atmosphere/floors, zero velocity
-                // Fallback fix if we're averaging, only fix if not
-                if(wsum < 1.e-10) {
-                    // We fill this with floor values below
-                    PRIMLOOP P(p, k, j, i) = 0.;
-                } else {
-                    PRIMLOOP P(p, k, j, i) = sum[p]/wsum;
-                }
-            }
+            if (failed(pflag(0, k, j, i)))
+                fix_zone(P, pflag, fix_average, b, k, j, i);
         }
     );
 
     // Re-apply floors to fixed zones
-    // Use values from floors package if it's enabled, otherwise any we've been asked to apply
-    const Floors::Prescription floors = pmb->packages.AllPackages().count("Floors") ?
-                                        pmb->packages.Get("Floors")->Param<Floors::Prescription>("prescription") :
-                                        pmb->packages.Get("Inverter")->Param<Floors::Prescription>("inverter_prescription");
+    const Floors::Prescription floors = fix_floors(pmb->packages);
 
     // We need the full packs of prims/cons for p_to_u
     // Pack new variables
@@ -128,15 +141,10 @@ TaskStatus Inverter::FixUtoP(MeshBlockData<Real> *rc)
     auto U = GRMHD::PackMHDCons(rc, cons_map);
     P = GRMHD::PackMHDPrims(rc, prims_map);
     const VarMap m_u(cons_map, true), m_p(prims_map, false);
-    // Get new sizes
-    const int nvar = P.GetDim(4);
-
-    // Get floor flag
-    GridScalar fflag = rc->Get("fflag").data;
 
     pmb->par_for("fix_U_to_P_floors", b.ks, b.ke, b.js, b.je, b.is, b.ie,
         KOKKOS_LAMBDA (const int &k, const int &j, const int &i) {
-            if (failed(pflag(k, j, i))) {
+            if (failed(pflag(0, k, j, i))) {
                 // Make sure all fixed values still abide by floors
                 // TODO Full floors instead of just geo?
                 Floors::apply_geo_floors(G, P, m_p, gam, k, j, i, floors);
@@ -151,3 +159,83 @@ TaskStatus Inverter::FixUtoP(MeshBlockData<Real> *rc)
     EndFlag();
     return TaskStatus::complete;
 }
+
+TaskStatus Inverter::MeshFixUtoP(MeshData<Real> *md)
+{
+    auto pmb0 = md->GetBlockData(0)->GetBlockPointer();
+    auto &pars = pmb0->packages.Get("Inverter")->AllParams();
+    const bool fix_average = pars.Get<bool>("fix_average_neighbors");
+    const bool fix_atmo = pars.Get<bool>("fix_atmosphere");
+    if (!fix_average && !fix_atmo) return TaskStatus::complete;
+
+    Flag("MeshFixUtoP");
+    // MeshUtoP & floors list the failures they find in the interior.  Add any in the ghost zones,
+    // which may have been synced from neighbors since, then fix only the listed zones.
+    // Fall back to sweeping each block if there's no list this cycle or it fills up
+    KDomain::ZoneList* list_cache = KDomain::TakeZoneList(*pars.GetMutable<KDomain::ZoneLists>("fail_lists"), md);
+    int nlist = 0;
+    if (list_cache != nullptr) {
+        const auto list = *list_cache;
+        auto pflag = md->PackVariables(std::vector<std::string>{"pflag"});
+        auto& ranges_cache = pars.GetMutable<KDomain::PhysicalRanges>("physical_ranges")->Get(md);
+        KDomain::GetPhysicalRanges(md, ranges_cache);
+        const auto ranges = ranges_cache;
+        const IndexRange3 be = KDomain::GetRange(md, IndexDomain::entire);
+        const IndexRange3 bi = KDomain::GetRange(md, IndexDomain::interior);
+        const IndexRange block = IndexRange{0, pflag.GetDim(5) - 1};
+        pmb0->par_for("fix_U_to_P_list_ghosts", block.s, block.e, be.ks, be.ke, be.js, be.je, be.is, be.ie,
+            KOKKOS_LAMBDA (const int& b, const int &k, const int &j, const int &i) {
+                if (KDomain::inside(k, j, i, bi) || KDomain::outside(k, j, i, ranges(b))) return;
+                if (failed(pflag(b, 0, k, j, i)))
+                    list.Add(b, k, j, i);
+            }
+        );
+        nlist = list.Size();
+        if (nlist > list.Capacity()) {
+            list_cache->Reset(2 * nlist);
+            list_cache = nullptr;
+        }
+    }
+    if (list_cache == nullptr) {
+        for (int i=0; i < md->NumBlocks(); ++i)
+            FixUtoP(md->GetBlockData(i).get());
+        EndFlag();
+        return TaskStatus::complete;
+    }
+    if (nlist == 0) {
+        EndFlag();
+        return TaskStatus::complete;
+    }
+
+    const auto list = *list_cache;
+    const auto ranges = pars.GetMutable<KDomain::PhysicalRanges>("physical_ranges")->Get(md);
+    auto pflag = md->PackVariables(std::vector<std::string>{"pflag"});
+    // As above, average only the core 5 prims, then floor & PtoU with everything
+    PackIndexMap hd_map, prims_map, cons_map;
+    auto P_HD = GRMHD::PackHDPrims(md, hd_map);
+    auto U = GRMHD::PackMHDCons(md, cons_map);
+    auto P = GRMHD::PackMHDPrims(md, prims_map);
+    const VarMap m_u(cons_map, true), m_p(prims_map, false);
+    const Real gam = pmb0->packages.Get("GRMHD")->Param<Real>("gamma");
+    const Floors::Prescription floors = fix_floors(pmb0->packages);
+
+    pmb0->par_for("fix_U_to_P", 0, nlist - 1,
+        KOKKOS_LAMBDA (const int& n) {
+            const int b = list.zones(n, 0), k = list.zones(n, 1), j = list.zones(n, 2), i = list.zones(n, 3);
+            fix_zone(P_HD(b), pflag(b), fix_average, ranges(b), k, j, i);
+        }
+    );
+    pmb0->par_for("fix_U_to_P_floors", 0, nlist - 1,
+        KOKKOS_LAMBDA (const int& n) {
+            const int b = list.zones(n, 0), k = list.zones(n, 1), j = list.zones(n, 2), i = list.zones(n, 3);
+            const auto& G = U.GetCoords(b);
+            const auto& P_b = P(b);
+            const auto& U_b = U(b);
+            Floors::apply_geo_floors(G, P_b, m_p, gam, k, j, i, floors);
+            GRMHD::p_to_u(G, P_b, m_p, gam, k, j, i, U_b, m_u);
+        }
+    );
+
+    EndFlag();
+    return TaskStatus::complete;
+}
@@ -78,6 +78,13 @@ KOKKOS_INLINE_FUNCTION bool failed(T status_flag)
  * 
  * On error, will not write replacement values, leaving the previous step's values in place
  * These are fixed later, in FixUtoP
+ *
+ * Solvers which can start from a previous solution read it from 'root' if it is given and positive,
+ * and store the converged value there (or 0 on failure) for next time.
+ * Solvers which find their initial bracket with a separate solve allow up to 'bracket_iterations'
+ * for it if given, otherwise max_iterations.  Only the main solve is then limited to max_iterations,
+ * and a bracketing solve which doesn't converge is reported as Status::max_iter.  The default of 0
+ * leaves the solve exactly as it is without a separate limit.
  * 
  * This is the function template: implementations are filled in in their own headers.
  * Be VERY CAREFUL to define any specializations by including those headers,
@@ -88,5 +95,6 @@ KOKKOS_INLINE_FUNCTION int u_to_p(const GRCoordinates& G, const VariablePack<Rea
                                               const Real& gam, const int& k, const int& j, const int& i,
                                               const VariablePack<Real>& P, const VarMap& m_p,
                                               const Loci& loc, const Floors::Prescription& inverter_floors,
-                                              const int& max_iterations, const Real& tol);
+                                              const int& max_iterations, const Real& tol,
+                                              Real* root=nullptr, const int& bracket_iterations=0);
 } // namespace Inverter
@@ -63,6 +63,16 @@ std::shared_ptr<KHARMAPackage> Inverter::Initialize(ParameterInput *pin, std::sh
     params.Add("err_tol", err_tol);
     int iter_max = pin->GetOrAddInteger("inverter", "iter_max", (use_kastaun) ? 25 : 8);
     params.Add("iter_max", iter_max);
+    // Start the Kastaun solve from each zone's root in the last inversion, falling back to the full
+    // bracket if that fails.  Costs a field, but usually cuts iterations to 1-2 in smooth flows
+    bool warm_start = pin->GetOrAddBoolean("inverter", "warm_start", false) && use_kastaun;
+    params.Add("warm_start", warm_start);
+    // Optionally run only this many iterations over every zone, so that vector lanes/GPU threads don't wait
+    // on the slowest zone in their group.  The few unconverged zones are then gathered into a list and
+    // finished with up to iter_max iterations.  0 (default) runs iter_max everywhere in one pass.
+    // Works best with warm_start, which lets most zones converge well within a few iterations
+    int first_pass_iter = pin->GetOrAddInteger("inverter", "first_pass_iter", 0);
+    params.Add("first_pass_iter", first_pass_iter);
 
     // Floor options
     // Use a custom block for inverter floors to allow customization.  Not sure anyone *wants* that but...
@@ -97,7 +107,24 @@ std::shared_ptr<KHARMAPackage> Inverter::Initialize(ParameterInput *pin, std::sh
     m = Metadata({Metadata::Real, Metadata::Cell, Metadata::Derived, Metadata::OneCopy, Metadata::Overridable});
     pkg->AddField("fflag", m);
 
+    if (warm_start) {
+        // Converged root of the last inversion, or 0 to start from scratch.
+        // Not synced or prolongated: new/refined blocks just start cold
+        m = Metadata({Metadata::Real, Metadata::Cell, Metadata::Derived, Metadata::OneCopy});
+        pkg->AddField("Inverter.root", m);
+    }
+
+    // Scratch & bookkeeping for the mesh-wide tasks below, one of each per MeshData partition.
+    // Physical ranges of blocks in a MeshData object, see MeshUtoP
+    params.Add("physical_ranges", KDomain::PhysicalRanges(), true);
+    // Zones left unconverged by the first pass, and the running count of them for diagnostics
+    params.Add("work_list", KDomain::ZoneLists(), true);
+    params.Add("second_pass_zones", KDomain::PartitionStore<int>(), true);
+    // Failed zones found by MeshUtoP & floors, for MeshFixUtoP
+    params.Add("fail_lists", KDomain::ZoneLists(), true);
+
     // We exist basically to do this
+    pkg->MeshUtoP = Inverter::MeshUtoP;
     pkg->BlockUtoP = Inverter::BlockUtoP;
     pkg->BoundaryUtoP = Inverter::BlockUtoP;
 
@@ -123,6 +150,8 @@ inline void BlockPerformInversion(MeshBlockData<Real> *rc, IndexDomain domain, b
 
     auto fflag = rc->PackVariables(std::vector<std::string>{"fflag"});
     auto pflag = rc->PackVariables(std::vector<std::string>{"pflag"});
+    auto root = rc->PackVariables(std::vector<std::string>{"Inverter.root"});
+    const bool warm_start = root.GetDim(4) > 0;
 
     if (U.GetDim(4) == 0 || pflag.GetDim(4) == 0)
         return;
@@ -143,7 +172,8 @@ inline void BlockPerformInversion(MeshBlockData<Real> *rc, IndexDomain domain, b
     pmb->par_for("U_to_P", b.ks, b.ke, b.js, b.je, b.is, b.ie,
         KOKKOS_LAMBDA (const int &k, const int &j, const int &i) {
             int pflagl = Inverter::u_to_p<inverter>(G, U, m_u, gam, k, j, i, P, m_p, Loci::center,
-                                                    inverter_floors, iter_max, err_tol);
+                                                    inverter_floors, iter_max, err_tol,
+                                                    (warm_start) ? &root(0, k, j, i) : nullptr);
             pflag(0, k, j, i) = pflagl % Floors::FFlag::MINIMUM;
             int fflagl = (pflagl / Floors::FFlag::MINIMUM) * Floors::FFlag::MINIMUM;
             fflag(0, k, j, i) = fflagl;
@@ -157,6 +187,134 @@ inline void BlockPerformInversion(MeshBlockData<Real> *rc, IndexDomain domain, b
     );
 }
 
+/**
+ * As BlockPerformInversion, over all blocks of a MeshData object at once
+ */
+template<Inverter::Type inverter>
+inline void MeshPerformInversion(MeshData<Real> *md, IndexDomain domain, bool coarse)
+{
+    auto pmb0 = md->GetBlockData(0)->GetBlockPointer();
+
+    PackIndexMap prims_map, cons_map;
+    auto U = GRMHD::PackMHDCons(md, cons_map);
+    auto P = GRMHD::PackHDPrims(md, prims_map);
+    const VarMap m_u(cons_map, true), m_p(prims_map, false);
+
+    auto fflag = md->PackVariables(std::vector<std::string>{"fflag"});
+    auto pflag = md->PackVariables(std::vector<std::string>{"pflag"});
+    auto root = md->PackVariables(std::vector<std::string>{"Inverter.root"});
+    const bool warm_start = root.GetDim(4) > 0;
+
+    if (U.GetDim(4) == 0 || pflag.GetDim(4) == 0)
+        return;
+
+    const Real gam = pmb0->packages.Get("GRMHD")->Param<Real>("gamma");
+
+    auto &pars = pmb0->packages.Get("Inverter")->AllParams();
+    const Real err_tol = pars.Get<Real>("err_tol");
+    const int iter_max = pars.Get<int>("iter_max");
+    Floors::Prescription inverter_floors = pars.Get<Floors::Prescription>("inverter_prescription");
+
+    // Each block recovers only its physical zones, see BlockPerformInversion.
+    // Launch over the whole block and skip the rest
+    auto& ranges_cache = pars.GetMutable<KDomain::PhysicalRanges>("physical_ranges")->Get(md);
+    KDomain::GetPhysicalRanges(md, ranges_cache);
+    const auto ranges = ranges_cache;
+    const IndexRange3 be = KDomain::GetRange(md, IndexDomain::entire, coarse);
+    const IndexRange block = IndexRange{0, U.GetDim(5) - 1};
+
+    // Optionally, split the solve into a short pass over everything and a full one over the stragglers
+    const int first_pass_iter = pars.Get<int>("first_pass_iter");
+    const bool two_pass = first_pass_iter > 0 && first_pass_iter < iter_max;
+
+    // Recover one zone with up to 'iterations' iterations of the main solve, returning the pflag.
+    // With two passes, any bracketing solve gets the full iter_max, so that a zone fails the first pass
+    // only by the limit we set.  With one, leave the solvers exactly as they were
+    const int bracket_iter = (two_pass) ? iter_max : 0;
+    auto recover = KOKKOS_LAMBDA (const int& b, const int &k, const int &j, const int &i, const int& iterations) {
+        const auto& G = U.GetCoords(b);
+        int pflagl = Inverter::u_to_p<inverter>(G, U(b), m_u, gam, k, j, i, P(b), m_p, Loci::center,
+                                                inverter_floors, iterations, err_tol,
+                                                (warm_start) ? &root(b, 0, k, j, i) : nullptr, bracket_iter);
+        pflag(b, 0, k, j, i) = pflagl % Floors::FFlag::MINIMUM;
+        fflag(b, 0, k, j, i) = (pflagl / Floors::FFlag::MINIMUM) * Floors::FFlag::MINIMUM;
+        return pflagl % Floors::FFlag::MINIMUM;
+    };
+
+    auto *list_cache = &pars.GetMutable<KDomain::ZoneLists>("work_list")->Get(md);
+    if (two_pass && list_cache->Capacity() == 0) {
+        // Start with room for a few percent of zones
+        const IndexSize3 s = KDomain::GetBlockSize(md, IndexDomain::interior);
+        const int nzones = (block.e + 1) * s.n1 * s.n2 * s.n3;
+        list_cache->Reset(m::max(nzones / 32, 1024));
+    } else if (two_pass) {
+        list_cache->Reset(0);
+    }
+    const auto list = *list_cache;
+    const int iter_first = (two_pass) ? first_pass_iter : iter_max;
+
+    // Record failures in the interior for MeshFixUtoP.  It checks ghost zones itself, as they may be synced over
+    const bool record_fails = !coarse;
+    const auto fail_list = (record_fails) ? KDomain::StartZoneList(*pars.GetMutable<KDomain::ZoneLists>("fail_lists"), md)
+                                          : KDomain::ZoneList();
+    const IndexRange3 bi = KDomain::GetRange(md, IndexDomain::interior);
+    auto record = KOKKOS_LAMBDA (const int& b, const int &k, const int &j, const int &i, const int& pflagl) {
+        if (record_fails && Inverter::failed(pflagl) && KDomain::inside(k, j, i, bi))
+            fail_list.Add(b, k, j, i);
+    };
+
+    pmb0->par_for("U_to_P", block.s, block.e, be.ks, be.ke, be.js, be.je, be.is, be.ie,
+        KOKKOS_LAMBDA (const int& b, const int &k, const int &j, const int &i) {
+            if (KDomain::outside(k, j, i, ranges(b))) return;
+            const int pflagl = recover(b, k, j, i, iter_first);
+            if (two_pass && pflagl == static_cast<int>(Inverter::Status::max_iter)) {
+                list.Add(b, k, j, i);
+            } else {
+                record(b, k, j, i, pflagl);
+            }
+        }
+    );
+
+    if (two_pass) {
+        const int nlist = list.Size();
+        pars.GetMutable<KDomain::PartitionStore<int>>("second_pass_zones")->Get(md) += nlist;
+        if (nlist > list.Capacity()) {
+            // List overflowed: sweep for the unconverged zones instead, and make room for next time
+            pmb0->par_for("U_to_P_second_pass", block.s, block.e, be.ks, be.ke, be.js, be.je, be.is, be.ie,
+                KOKKOS_LAMBDA (const int& b, const int &k, const int &j, const int &i) {
+                    if (KDomain::outside(k, j, i, ranges(b))) return;
+                    if (pflag(b, 0, k, j, i) == static_cast<int>(Inverter::Status::max_iter))
+                        record(b, k, j, i, recover(b, k, j, i, iter_max));
+                }
+            );
+            list_cache->Reset(2 * nlist);
+        } else if (nlist > 0) {
+            pmb0->par_for("U_to_P_second_pass", 0, nlist - 1,
+                KOKKOS_LAMBDA (const int& n) {
+                    const int b = list.zones(n, 0), k = list.zones(n, 1), j = list.zones(n, 2), i = list.zones(n, 3);
+                    record(b, k, j, i, recover(b, k, j, i, iter_max));
+                }
+            );
+        }
+    }
+}
+
+TaskStatus Inverter::MeshUtoP(MeshData<Real> *md, IndexDomain domain, bool coarse)
+{
+    auto& type = md->GetMeshPointer()->packages.Get("Inverter")->Param<Type>("inverter_type");
+    switch(type) {
+    case Type::onedw:
+        MeshPerformInversion<Type::onedw>(md, domain, coarse);
+        break;
+    case Type::kastaun:
+        MeshPerformInversion<Type::kastaun>(md, domain, coarse);
+        break;
+    case Type::none:
+        break;
+    }
+    return TaskStatus::complete;
+}
+
 void Inverter::BlockUtoP(MeshBlockData<Real> *rc, IndexDomain domain, bool coarse)
 {
     // This only chooses an implementation.  See BlockPerformInversion and implementations e.g. onedw.hpp
@@ -182,6 +340,7 @@ TaskStatus Inverter::PostStepDiagnostics(const SimTime& tm, MeshData<Real> *md)
     // Options
     const auto& pars = pmesh->packages.Get("Globals")->AllParams();
     const int flag_verbose = pars.Get<int>("flag_verbose");
+    auto& inverter_pars = pmesh->packages.Get("Inverter")->AllParams();
 
     // Debugging/diagnostic info about inversion flags
     // TODO grab the total and die on too many
@@ -198,5 +357,18 @@ TaskStatus Inverter::PostStepDiagnostics(const SimTime& tm, MeshData<Real> *md)
         }
     }
 
+    // Zones which needed more than first_pass_iter iterations this step
+    if (flag_verbose >= 2 && inverter_pars.Get<int>("first_pass_iter") > 0) {
+        int second_pass_zones = 0;
+        inverter_pars.GetMutable<KDomain::PartitionStore<int>>("second_pass_zones")->ForEach(
+            [&second_pass_zones](int& n) { second_pass_zones += n; });
+        Reductions::Start<int>(md, 6, second_pass_zones, MPI_SUM);
+        const int ntotal = Reductions::Check<int>(md, 6);
+        if (MPIRank0())
+            std::cout << "Inverter: " << ntotal << " zone recoveries needed more than "
+                      << inverter_pars.Get<int>("first_pass_iter") << " iterations" << std::endl;
+    }
+    inverter_pars.GetMutable<KDomain::PartitionStore<int>>("second_pass_zones")->ForEach([](int& n) { n = 0; });
+
     return TaskStatus::complete;
 }
@@ -65,13 +65,10 @@ std::shared_ptr<KHARMAPackage> Initialize(ParameterInput *pin, std::shared_ptr<P
  * output: U and P match down to inversion errors
  */
 void BlockUtoP(MeshBlockData<Real> *rc, IndexDomain domain, bool coarse);
-inline TaskStatus MeshUtoP(MeshData<Real> *md, IndexDomain domain, bool coarse) {
-    Flag("MeshUtoP");
-    for (int i=0; i < md->NumBlocks(); ++i)
-        BlockUtoP(md->GetBlockData(i).get(), domain, coarse);
-    EndFlag();
-    return TaskStatus::complete;
-}
+/**
+ * Recover primitive variables over all blocks of 'md' in a single kernel
+ */
+TaskStatus MeshUtoP(MeshData<Real> *md, IndexDomain domain, bool coarse);
 
 /**
  * Smooth over inversion failures, usually by averaging values of the primitive variables from each neighboring zone
@@ -80,13 +77,11 @@ inline TaskStatus MeshUtoP(MeshData<Real> *md, IndexDomain domain, bool coarse)
  * LOCKSTEP: this function expects and should preserve P<->U
  */
 TaskStatus FixUtoP(MeshBlockData<Real> *rc);
-inline TaskStatus MeshFixUtoP(MeshData<Real> *md) {
-    Flag("MeshFixUtoP");
-    for (int i=0; i < md->NumBlocks(); ++i)
-        FixUtoP(md->GetBlockData(i).get());
-    EndFlag();
-    return TaskStatus::complete;
-}
+/**
+ * As FixUtoP, over all blocks of 'md'.  Visits only the failed zones listed by MeshUtoP this cycle
+ * plus any in ghost zones, falling back to FixUtoP on each block if there is no such list
+ */
+TaskStatus MeshFixUtoP(MeshData<Real> *md);
 
 /**
  * Print details of any inversion failures or fixed zones
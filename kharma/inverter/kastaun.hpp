@@ -74,6 +74,48 @@
 
 namespace Inverter {
 
+// Half-width of the bracket around a previous solution, relative to it, see u_to_p<Type::kastaun>
+static constexpr Real kastaun_warm_width = 1.e-2;
+
+/**
+ * Root of f in [zm, zp], with f(zm) = fm and f(zp) = fp of opposite sign, by false position
+ * with the "Illinois" modification.  On return 'iter' is the number of iterations taken,
+ * equal to max_iterations if the solve did not converge
+ */
+template<typename Function>
+KOKKOS_INLINE_FUNCTION Real illinois_solve(Function f, Real zm, Real zp, Real fm, Real fp,
+                                           const int& max_iterations, const Real& tol, int& iter)
+{
+    int iterations = max_iterations;
+    // If bracket within tolerances, don't bother doing any iterations
+    if ((m::abs(zm-zp) < tol) || ((m::abs(fm) + m::abs(fp)) < 2.0*tol)) {
+        iterations = -1;
+    }
+    Real z = 0.5*(zm + zp);
+
+    for (iter=0; iter<iterations; ++iter) {
+        z = (zm*fp - zp*fm)/(fp-fm);  // linear interpolation to point f(z)=0
+        Real f_z = f(z);
+        // Quit if convergence reached
+        // NOTE(@ermost): both z and f are of order unity
+        if ((m::abs(zm-zp) < tol) || (m::abs(f_z) < tol)) {
+            break;
+        }
+        // assign zm-->zp if root bracketed by [z,zp]
+        if (f_z*fp < 0.0) {
+            zm = zp;
+            fm = fp;
+            zp = z;
+            fp = f_z;
+        } else {  // assign zp-->z if root bracketed by [zm,z]
+            fm = 0.5*fm; // 1/2 comes from "Illinois algorithm" to accelerate convergence
+            zp = z;
+            fp = f_z;
+        }
+    }
+    return z;
+}
+
 /**
  * Residual class from Phoebus, allowing caching of:
  * 1. Function arguments other than solution var "mu"
@@ -208,7 +250,8 @@ class KastaunResidual {
  * Robust inversion scheme from Kastaun et al. 2020
  * Unholy mashup of the transformation/equations from Phoebus (which are coordinate-general),
  * and the solver from AthenaK (which is easier to read and precomputes the bracket)
- * TODO keep mu between calls to speed up convergence
+ * If 'root' holds a previous solution mu, first tries a bracket of relative width kastaun_warm_width around it,
+ * which in smooth flow converges in one or two iterations.  Falls back to the full bracket if the root is not there
  * TODO better returns: be explicit about pre- and post-inversion floors, cat neg_input too
  */
 template <>
@@ -216,7 +259,8 @@ KOKKOS_INLINE_FUNCTION int u_to_p<Type::kastaun>(const GRCoordinates& G, const V
                                               const Real& gam, const int& k, const int& j, const int& i,
                                               const VariablePack<Real>& P, const VarMap& m_p,
                                               const Loci& loc, const Floors::Prescription& inverter_floors,
-                                              const int& max_iterations, const Real& tol)
+                                              const int& max_iterations, const Real& tol,
+                                              Real* root, const int& bracket_iterations)
 {
     // Shouldn't need this, KHARMA should die on NaN
     // But it's here for debugging
@@ -298,89 +342,54 @@ KOKKOS_INLINE_FUNCTION int u_to_p<Type::kastaun>(const GRCoordinates& G, const V
                         inverter_floors.gamma_max, inverter_floors.u_over_rho_max);
 
     // SOLVE
-    // TODO(BSP) better or faster solver?  (Optionally) skip bracketing?
-    // Need to find initial bracket. Requires separate solve
-    Real zm = 0.;
-    Real zp = 1.; // This is the lowest specific enthalpy admitted by the EOS
-
-    // Evaluate master function (eq 49) at bracket values
-    Real fm = res.aux_func(zm);
-    Real fp = res.aux_func(zp);
-
-    // For simplicity on the GPU, find roots using the false position method
-    int iterations = max_iterations;
-    // If bracket within tolerances, don't bother doing any iterations
-    if ((m::abs(zm-zp) < tol) || ((m::abs(fm) + m::abs(fp)) < 2.0*tol)) {
-        iterations = -1;
-    }
-    Real z = 0.5*(zm + zp);
-
-    int iter;
-    for (iter=0; iter<iterations; ++iter) {
-        z =  (zm*fp - zp*fm)/(fp-fm);  // linear interpolation to point f(z)=0
-        Real f = res.aux_func(z);
-        // Quit if convergence reached
-        // NOTE(@ermost): both z and f are of order unity
-        if ((m::abs(zm-zp) < tol) || (m::abs(f) < tol)) {
-            break;
+    Real z = 0.;
+    int iter = max_iterations;
+    auto master = [&res](const Real mu) { return res(mu); };
+
+    // Try a narrow bracket around last solve's root
+    if (root != nullptr && *root > 0.) {
+        const Real zm = *root * (1. - kastaun_warm_width);
+        const Real zp = m::min(*root * (1. + kastaun_warm_width), 1.);
+        const Real fm = res(zm);
+        const Real fp = res(zp);
+        if (fm * fp <= 0.) {
+            z = illinois_solve(master, zm, zp, fm, fp, max_iterations, tol, iter);
         }
-        // assign zm-->zp if root bracketed by [z,zp]
-        if (f*fp < 0.0) {
-            zm = zp;
-            fm = fp;
-            zp = z;
-            fp = f;
-        } else {  // assign zp-->z if root bracketed by [zm,z]
-            fm = 0.5*fm; // 1/2 comes from "Illinois algorithm" to accelerate convergence
-            zp = z;
-            fp = f;
-        }
-    }
-    // TODO keep track of bracket iter?
-
-    // Found brackets. Now find solution in bounded interval, again using the
-    // false position method
-    zm = 0.;
-    zp = z;
-
-    // Evaluate master function (eq 44) at bracket values
-    fm = res(zm);
-    fp = res(zp);
-
-    iterations = max_iterations;
-    if ((m::abs(zm-zp) < tol) || ((m::abs(fm) + m::abs(fp)) < 2.0*tol)) {
-        iterations = -1;
     }
-    z = 0.5*(zm + zp);
 
-    for (iter=0; iter<iterations; ++iter) {
-        z = (zm*fp - zp*fm)/(fp-fm);  // linear interpolation to point f(z)=0
-        Real f = res(z);
-        // Quit if convergence reached
-        // NOTE: both z and f are of order unity
-        if ((m::abs(zm-zp) < tol) || (m::abs(f) < tol)) {
-            break;
-        }
-        // assign zm-->zp if root bracketed by [z,zp]
-        if (f*fp < 0.0) {
-            zm = zp;
-            fm = fp;
-            zp = z;
-            fp = f;
-        } else {  // assign zp-->z if root bracketed by [zm,z]
-            fm = 0.5*fm; // 1/2 comes from "Illinois algorithm" to accelerate convergence
-            zp = z;
-            fp = f;
+    if (iter == max_iterations) {
+        // Need to find initial bracket. Requires separate solve
+        // For simplicity on the GPU, find roots using the false position method
+        const Real zm = 0.;
+        const Real zp = 1.; // This is the lowest specific enthalpy admitted by the EOS
+        // Evaluate master function (eq 49) at bracket values
+        const int bracket_max = (bracket_iterations > 0) ? bracket_iterations : max_iterations;
+        const Real z_bracket = illinois_solve([&res](const Real mu) { return res.aux_func(mu); },
+                                              zm, zp, res.aux_func(zm), res.aux_func(zp),
+                                              bracket_max, tol, iter);
+        // With a separate limit (i.e., in the first pass of a two-pass inversion), don't solve in a
+        // bad bracket: report the failure like any other, so the zone isn't retried in the same bracket.
+        // Otherwise, keep the single-pass behavior of trying the main solve regardless
+        if (bracket_iterations > 0 && iter == bracket_max) {
+            if (root != nullptr) *root = 0.;
+            return static_cast<int>(Status::max_iter);
         }
+
+        // Found brackets. Now find solution in bounded interval, again using the
+        // false position method
+        // Evaluate master function (eq 44) at bracket values
+        z = illinois_solve(master, zm, z_bracket, res(zm), res(z_bracket), max_iterations, tol, iter);
+        // TODO keep track of max iter
     }
-    // TODO keep track of max iter
 
     // check if convergence is established within max_iterations.  If not, return
     // failure without replacing prims, for consistency w/1Dw solver.
     // We generally replace failed zones with atmosphere later, at user option
     if (iter == max_iterations) {
+        if (root != nullptr) *root = 0.;
         return static_cast<int>(Status::max_iter);
     }
+    if (root != nullptr) *root = z;
 
     // Now unwrap everything into primitive vars...
     const Real mu = z;
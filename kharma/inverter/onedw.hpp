@@ -91,7 +91,8 @@ KOKKOS_INLINE_FUNCTION int u_to_p<Type::onedw>(const GRCoordinates& G, const Var
                                               const Real& gam, const int& k, const int& j, const int& i,
                                               const VariablePack<Real>& P, const VarMap& m_p,
                                               const Loci& loc, const Floors::Prescription& inverter_floors,
-                                              const int& max_iterations, const Real& tol)
+                                              const int& max_iterations, const Real& tol,
+                                              Real* root, const int& bracket_iterations)
 {
     // TODO try inline floors in the old 1Dw?  Probably not relevant anymore
     // Catch negative density
@@ -33,6 +33,7 @@
  */
 #include "kharma_package.hpp"
 
+#include "floors.hpp"
 #include "types.hpp"
 
 // TODO clearly this needs a better concept of ordering.
@@ -90,10 +91,31 @@ TaskStatus Packages::BlockUtoP(MeshBlockData<Real> *rc, IndexDomain domain, bool
 }
 TaskStatus Packages::MeshUtoP(MeshData<Real> *md, IndexDomain domain, bool coarse)
 {
-    // TODO TODO prefer MeshUtoP implementations and fall back
     Flag("MeshUtoP");
-    for (int i=0; i < md->NumBlocks(); ++i)
-        BlockUtoP(md->GetBlockData(i).get(), domain, coarse);
+    // Prefer each package's MeshUtoP, which covers all blocks in one kernel,
+    // and fall back to its BlockUtoP per-block. Same ordering as BlockUtoP
+    auto pmesh = md->GetMeshPointer();
+    auto kpackages = pmesh->packages.AllPackagesOfType<KHARMAPackage>();
+    auto package_utop = [&](const std::string& name, KHARMAPackage *pkg) {
+        if (pkg->MeshUtoP != nullptr) {
+            Flag("MeshUtoP_"+name);
+            pkg->MeshUtoP(md, domain, coarse);
+            EndFlag();
+        } else if (pkg->BlockUtoP != nullptr) {
+            Flag("BlockUtoP_"+name);
+            for (int i=0; i < md->NumBlocks(); ++i)
+                pkg->BlockUtoP(md->GetBlockData(i).get(), domain, coarse);
+            EndFlag();
+        }
+    };
+    if (kpackages.count("B_CT"))
+        package_utop("B_CT", kpackages["B_CT"]);
+    if (kpackages.count("Inverter"))
+        package_utop("Inverter", kpackages["Inverter"]);
+    for (auto kpackage : kpackages) {
+        if (kpackage.first != "B_CT" && kpackage.first != "Inverter")
+            package_utop(kpackage.first, kpackage.second);
+    }
     EndFlag();
     return TaskStatus::complete;
 }
@@ -186,6 +208,35 @@ TaskStatus Packages::MeshApplyPrimSource(MeshData<Real> *md)
     return TaskStatus::complete;
 }
 
+TaskStatus Packages::MeshUtoPAndFloors(MeshData<Real> *md, IndexDomain domain)
+{
+    Flag("MeshUtoPAndFloors");
+    // Everything but the Inverter is a B field package here (see driver/fused_utop in Flux::Initialize),
+    // so recover B first as the floors need it
+    auto pmesh = md->GetMeshPointer();
+    auto kpackages = pmesh->packages.AllPackagesOfType<KHARMAPackage>();
+    for (auto kpackage : kpackages) {
+        KHARMAPackage *pkg = kpackage.second;
+        if (kpackage.first == "Inverter") continue;
+        if (pkg->MeshUtoP != nullptr) {
+            Flag("MeshUtoP_"+kpackage.first);
+            pkg->MeshUtoP(md, domain, false);
+            EndFlag();
+        } else if (pkg->BlockUtoP != nullptr) {
+            Flag("BlockUtoP_"+kpackage.first);
+            for (int i=0; i < md->NumBlocks(); ++i)
+                pkg->BlockUtoP(md->GetBlockData(i).get(), domain, false);
+            EndFlag();
+        }
+    }
+    // Then the fluid, floors & ceilings together
+    Flag("MeshUtoPAndFloors_Floors");
+    Floors::MeshUtoPAndFloors(md, domain);
+    EndFlag();
+    EndFlag();
+    return TaskStatus::complete;
+}
+
 TaskStatus Packages::MeshApplyFloors(MeshData<Real> *md, IndexDomain domain)
 {
     Flag("MeshApplyFloors");
@@ -165,6 +165,13 @@ TaskStatus MeshApplyPrimSource(MeshData<Real> *md);
  * LOCKSTEP: this function respects P and returns consistent P<->U
  */
 TaskStatus MeshApplyFloors(MeshData<Real> *md, IndexDomain domain);
+/**
+ * MeshUtoP followed by MeshApplyFloors, with the fluid inversion, floors and ceilings fused into
+ * one kernel.  Only valid with driver/fused_utop, which checks the loaded packages support it.
+ * 
+ * LOCKSTEP: this function expects U and returns consistent P<->U
+ */
+TaskStatus MeshUtoPAndFloors(MeshData<Real> *md, IndexDomain domain);
 
 // These are already Parthenon global callbacks -- see their documentation
 // I define them here so I can pass them on to packages
@@ -36,6 +36,7 @@
 #include "decs.hpp"
 
 #include "boundaries.hpp"
+#include "gr_coordinates.hpp"
 #include "kharma_driver.hpp"
 #include "kharma.hpp"
 #include "post_initialize.hpp"
@@ -146,10 +147,12 @@ int main(int argc, char *argv[])
     // Check the Parthenon init return code, initialize packages/mesh
     Flag("InitPackagesAndMesh");
     if (manager_status == ParthenonStatus::complete) {
+        ClearGeometryStore();
         pman.ParthenonFinalize();
         return 0;
     }
     if (manager_status == ParthenonStatus::error) {
+        ClearGeometryStore();
         pman.ParthenonFinalize();
         return 1;
     }
@@ -248,6 +251,8 @@ int main(int argc, char *argv[])
     }
 
     // Parthenon cleanup includes Kokkos, MPI
+    // Our shared geometry must be released first
+    ClearGeometryStore();
     Flag("ParthenonFinalize");
     pman.ParthenonFinalize();
     EndFlag();
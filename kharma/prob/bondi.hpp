@@ -189,7 +189,7 @@ KOKKOS_INLINE_FUNCTION void get_prim_bondi(const GRCoordinates& G, const bool di
     // Get the native-coordinate 4-vector corresponding to ur
     const Real ucon_bl[GR_DIM] = {0, ur * ur_frac, 0, uphi * m::pow(r,-3./2.)};
     Real ucon_native[GR_DIM];
-    G.coords.bl_fourvel_to_native(Xnative, ucon_bl, ucon_native);
+    G.bl_fourvel_to_native(k, j, i, ucon_bl, ucon_native);
 
     // Convert native 4-vector to primitive u-twiddle, see Gammie '04
     Real gcon[GR_DIM][GR_DIM];
@@ -111,7 +111,7 @@ TaskStatus InitializeFMTorus(std::shared_ptr<MeshBlockData<Real>>& rc, Parameter
                 // Then set u^t and transform the 4-vector to KS if necessary,
                 // and then to native coordinates
                 Real ucon_native[GR_DIM];
-                G.coords.bl_fourvel_to_native(Xnative, ucon_bl, ucon_native);
+                G.bl_fourvel_to_native(k, j, i, ucon_bl, ucon_native);
 
                 // Convert native 4-vector to primitive u-twiddle, see Gammie '04
                 Real gcon[GR_DIM][GR_DIM], u_prim[NVEC];
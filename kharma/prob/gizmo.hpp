@@ -126,7 +126,7 @@ KOKKOS_INLINE_FUNCTION void get_prim_gizmo_shell(const GRCoordinates& G, const C
 
     // Set u^t and transform to native coordinates
     GReal ucon_native[GR_DIM];
-    G.coords.bl_fourvel_to_native(Xnative, ucon_bl, ucon_native);
+    G.bl_fourvel_to_native(k, j, i, ucon_bl, ucon_native);
 
     // Convert native 4-vector to primitive u-twiddle, see Gammie '04
     Real gcon[GR_DIM][GR_DIM], u_prim[NVEC];
@@ -22,6 +22,10 @@
 # noimplicit: Disable implicit solver, avoids pulling in Kokkos-kernels
 # nocleanup:  Disable magnetic field cleaning code for resizing, avoids
 #             pulling in some unofficial Parthenon code.
+# simd:       Use explicitly vectorized WENO5/MP5/PPM reconstruction (CPU only)
+# fluxsp:     Store the face temporaries between flux kernels in single precision
+# Set FIXED_COORDINATES=Base,Transform in the environment (e.g. SphKSCoords,FunkyTransform)
+# to compile for just one coordinate system, inlining the metric into kernels
 # Many machine files have additional options, check machines/machinename.sh
 
 # Make processes to use
@@ -72,6 +76,15 @@ fi
 if [[ "$ARGS" == *"nocleanup"* ]]; then
   EXTRA_FLAGS="-DKHARMA_DISABLE_CLEANUP=1 $EXTRA_FLAGS"
 fi
+if [[ "$ARGS" == *"simd"* ]]; then
+  EXTRA_FLAGS="-DKHARMA_SIMD_RECONSTRUCTION=1 $EXTRA_FLAGS"
+fi
+if [[ "$ARGS" == *"fluxsp"* ]]; then
+  EXTRA_FLAGS="-DKHARMA_FLUX_SINGLE_PRECISION=1 $EXTRA_FLAGS"
+fi
+if [[ -v FIXED_COORDINATES ]]; then
+  EXTRA_FLAGS="-DKHARMA_FIXED_BASE=${FIXED_COORDINATES%,*} -DKHARMA_FIXED_TRANSFORM=${FIXED_COORDINATES#*,} $EXTRA_FLAGS"
+fi
 
 ### Enivoronment Prep ###
 if [[ "$(which python3 2>/dev/null)" == *"conda"* ]]; then
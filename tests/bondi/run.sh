@@ -43,6 +43,7 @@ conv_2d eks coordinates/transform=eks "in 2D, EKS coordinates"
 ALL_RES="48,64,96,128"
 conv_2d fmks coordinates/transform=fmks "in 2D, FMKS coordinates"
 conv_2d ks coordinates/transform=null "in 2D, KS coordinates"
+conv_2d fmks_dual "coordinates/transform=fmks coordinates/dual_connection=true" "in 2D, FMKS coordinates, exact connection"
 
 # Recon
 ALL_RES="16,24,32,48,64"
@@ -4,5 +4,6 @@
 TEST_DIR=$(dirname "$(readlink -f "$0")")
 rm -rf ${TEST_DIR}/*/*.{phdf,xdmf,rhdf,h5,hst,txt,png} \
        ${TEST_DIR}/tilt_init/mks \
+       ${TEST_DIR}/torus_sanity/geometry_cache \
        ${TEST_DIR}/*/frames_* \
        ${TEST_DIR}/*/kharma_parsed_parameters*
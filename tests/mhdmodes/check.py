@@ -23,6 +23,10 @@ else:
 
 print(DIR)
 
+# Allowed deviation of the convergence order from 2.  Builds which trade accuracy for speed
+# (e.g. single-precision flux temporaries) set a looser value, see run_fluxsp.sh
+ORDER_TOL = float(os.environ.get("MHDMODES_ORDER_TOL", "0.1"))
+
 NVAR = 8
 VARS = ['rho', 'u', 'u1', 'u2', 'u3', 'B1', 'B2', 'B3']
 
@@ -136,7 +140,7 @@ for k in range(NVAR):
 
         print("Power fit {}: {} {}".format(VARS[k], powerfits[k], L1[:,k]))
         # These bounds were chosen heuristically: fast u2/u3 converge fast
-        if powerfits[k] > -1.9 or ("entropy" not in SHORT and powerfits[k] < -2.1):
+        if powerfits[k] > -2. + ORDER_TOL or ("entropy" not in SHORT and powerfits[k] < -2. - ORDER_TOL):
             # Allow entropy wave to converge fast, otherwise everything is ~2
             fail = 1
 
@@ -123,10 +123,36 @@ conv_2d slow_kharma_ct_gs05_c   "mhdmodes/nmode=1 driver/type=kharma b_field/sol
 conv_2d alfven_kharma_ct_gs05_c "mhdmodes/nmode=2 driver/type=kharma b_field/solver=face_ct b_field/ct_scheme=gs05_c" "Alfven mode in 2D, KHARMA driver w/epsilon_c flux"
 conv_2d fast_kharma_ct_gs05_c   "mhdmodes/nmode=3 driver/type=kharma b_field/solver=face_ct b_field/ct_scheme=gs05_c" "fast mode in 2D, KHARMA driver w/epsilon_c flux"
 
+# Single-kernel flux calculation
+conv_2d slow_fused   "mhdmodes/nmode=1 flux/fused=true" "slow mode in 2D, fused flux kernel"
+conv_2d alfven_fused "mhdmodes/nmode=2 flux/fused=true" "Alfven mode in 2D, fused flux kernel"
+conv_2d fast_fused   "mhdmodes/nmode=3 driver/type=kharma flux/fused=true b_field/solver=face_ct b_field/ct_scheme=gs05_c" "fast mode in 2D, fused flux kernel w/face CT"
+
+# Fallback to PPM at flagged faces
+conv_2d fast_fallback "mhdmodes/nmode=3 driver/reconstruction=weno5 flux/reconstruction_fallback=true" "fast mode in 2D, WENO5 w/PPM fallback"
+
+# PPM in smooth zones, WENO5 elsewhere
+conv_2d fast_hybrid "mhdmodes/nmode=3 driver/reconstruction=hybrid" "fast mode in 2D, hybrid PPM/WENO5 reconstruction"
+
+# X2/X3 reconstruction through scratch tiles
+conv_2d alfven_tile "mhdmodes/nmode=2 flux/tile_reconstruction=true" "Alfven mode in 2D, tiled reconstruction"
+conv_3d fast_tile   "mhdmodes/nmode=3 flux/tile_reconstruction=true flux/tile_rows=5 driver/reconstruction=weno5" "fast mode in 3D, tiled WENO5 reconstruction, partial tiles"
+
+# All three flux directions from one kernel
+conv_2d alfven_multidir "mhdmodes/nmode=2 driver/type=kharma flux/multi_direction=true b_field/solver=face_ct b_field/ct_scheme=gs05_c" "Alfven mode in 2D, multi-direction fluxes w/face CT"
+conv_3d fast_multidir   "mhdmodes/nmode=3 flux/multi_direction=true flux/multi_direction_tile=3 driver/reconstruction=weno5" "fast mode in 3D, multi-direction WENO5 fluxes, partial tiles"
+
+# Flux divergence, geometric source & RK update in one kernel
+conv_2d alfven_fused_update    "mhdmodes/nmode=2 driver/type=kharma driver/fused_update=true" "Alfven mode in 2D, fused flux divergence & update"
+conv_2d alfven_fused_update_ct "mhdmodes/nmode=2 driver/type=kharma driver/fused_update=true b_field/solver=face_ct b_field/ct_scheme=gs05_c" "Alfven mode in 2D, fused update w/face CT"
+
 # Kastaun primitive recovery
 conv_2d slow_kastaun   "mhdmodes/nmode=1 inverter/type=kastaun" "slow mode in 2D, Kastaun inversion"
 conv_2d alfven_kastaun "mhdmodes/nmode=2 inverter/type=kastaun" "Alfven mode in 2D, Kastaun inversion"
 conv_2d fast_kastaun   "mhdmodes/nmode=3 inverter/type=kastaun" "fast mode in 2D, Kastaun inversion"
+conv_2d fast_kastaun_warm "mhdmodes/nmode=3 inverter/type=kastaun inverter/warm_start=true" "fast mode in 2D, warm-started Kastaun inversion"
+conv_2d fast_kastaun_two_pass "mhdmodes/nmode=3 inverter/type=kastaun inverter/warm_start=true inverter/first_pass_iter=3" "fast mode in 2D, two-pass Kastaun inversion"
+conv_2d fast_kastaun_fused_utop "mhdmodes/nmode=3 driver/type=kharma inverter/type=kastaun floors/disable_floors=false driver/fused_utop=true" "fast mode in 2D, Kastaun inversion fused w/floors"
 
 
 # simple driver, high res
@@ -0,0 +1,47 @@
+#!/bin/bash
+set -euo pipefail
+
+BASE=../..
+
+# Sanity check for builds with KHARMA_FLUX_SINGLE_PRECISION ("./make.sh fluxsp").
+# Face states, conserved variables & fluxes are rounded to float between the flux kernels,
+# an error of ~6e-8 relative to the O(1) background state.  The modes have amplitude 1e-4, so
+# at the resolutions of the full suite (up to 64^2) this rounding approaches the truncation error,
+# and the measured order is no longer meaningful.
+# Instead, run a few modes at resolutions where truncation error is still ~1e-6 or more, and require
+# order 2 +/- 0.3 rather than +/- 0.1
+
+exit_code=0
+export MHDMODES_ORDER_TOL=0.3
+
+conv_2d() {
+    IFS=',' read -ra RES_LIST <<< "$ALL_RES"
+    for res in "${RES_LIST[@]}"
+    do
+      # Four blocks
+      half=$(( $res / 2 ))
+      $BASE/run.sh -i $BASE/pars/tests/mhdmodes.par debug/verbose=2 mhdmodes/dir=3 \
+                      parthenon/output0/single_precision_output=false parthenon/output0/dt=100. \
+                      parthenon/mesh/nx1=$res parthenon/mesh/nx2=$res parthenon/mesh/nx3=1 \
+                      parthenon/meshblock/nx1=$half parthenon/meshblock/nx2=$half parthenon/meshblock/nx3=1 \
+                      $2 >log_2d_${1}_${res}.txt 2>&1
+        mv mhdmodes.out0.00000.phdf mhd_2d_${1}_${res}_start.phdf
+        mv mhdmodes.out0.final.phdf mhd_2d_${1}_${res}_end.phdf
+    done
+    check_code=0
+    python check.py $ALL_RES "$3" $1  2d || check_code=$?
+    if [[ $check_code != 0 ]]; then
+        echo MHD modes test \"$3\" FAIL: $check_code
+        exit_code=1
+    else
+        echo MHD modes test \"$3\" success
+    fi
+}
+
+ALL_RES="16,24,32"
+conv_2d slow_fluxsp   "mhdmodes/nmode=1 driver/type=kharma" "slow mode in 2D, single-precision flux temporaries"
+conv_2d alfven_fluxsp "mhdmodes/nmode=2 driver/type=kharma" "Alfven mode in 2D, single-precision flux temporaries"
+conv_2d fast_fluxsp   "mhdmodes/nmode=3 driver/type=kharma" "fast mode in 2D, single-precision flux temporaries"
+conv_2d fast_fluxsp_face "mhdmodes/nmode=3 driver/type=kharma b_field/solver=face_ct b_field/ct_scheme=gs05_c" "fast mode in 2D, single-precision flux temporaries w/face CT"
+
+exit $exit_code
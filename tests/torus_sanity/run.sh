@@ -11,7 +11,82 @@ check_sanity() {
     pyharm check-basics -d --allowed_divb=1e-10 torus.out0.final.phdf || exit_code=$?
 }
 
+check_table() {
+    # Tabulated dCS metric: the table must build, report its error, and stay within tolerance
+    $BASE/run.sh -i ./mad_test.par $2 >log_table_${1}.txt 2>&1 || exit_code=$?
+
+    if ! grep -q "max relative error" log_table_${1}.txt; then
+        echo "Metric table was not built for ${1}"
+        exit_code=1
+    fi
+    if grep -q "is above coordinates/table_tolerance" log_table_${1}.txt; then
+        echo "Metric table error for ${1} is above tolerance"
+        exit_code=1
+    fi
+
+    # A table too coarse for the tolerance must stop the run
+    if $BASE/run.sh -i ./mad_test.par $2 coordinates/table_n1=32 coordinates/table_n2=16 >log_table_${1}_coarse.txt 2>&1; then
+        echo "Coarse metric table for ${1} did not fail"
+        exit_code=1
+    fi
+    if ! grep -q "is above coordinates/table_tolerance" log_table_${1}_coarse.txt; then
+        echo "Coarse metric table for ${1} was not caught by the tolerance check"
+        exit_code=1
+    fi
+}
+
+check_geometry_cache() {
+    # First run fills the on-disk geometry cache, second reads it back: results must be identical
+    rm -rf geometry_cache
+    $BASE/run.sh -i ./mad_test.par coordinates/geometry_cache_dir=geometry_cache $2 >log_cache_${1}_first.txt 2>&1 || exit_code=$?
+    mv torus.out0.final.phdf cache_${1}_first.phdf
+    if ! ls geometry_cache/geometry_*.bin >/dev/null 2>&1; then
+        echo "Geometry cache was not written for ${1}"
+        exit_code=1
+    fi
+    nfiles=$(ls geometry_cache/geometry_*.bin | wc -l)
+
+    $BASE/run.sh -i ./mad_test.par coordinates/geometry_cache_dir=geometry_cache $2 >log_cache_${1}_second.txt 2>&1 || exit_code=$?
+    mv torus.out0.final.phdf cache_${1}_second.phdf
+
+    pyharm diff --rel_tol 1e-14 cache_${1}_first.phdf cache_${1}_second.phdf --no_plot || exit_code=$?
+
+    # The second run must have read every file back, rather than writing new ones
+    if [ $(ls geometry_cache/geometry_*.bin | wc -l) -ne $nfiles ]; then
+        echo "Geometry cache was not reused for ${1}"
+        exit_code=1
+    fi
+
+    # Any parameter in <coordinates> might change the geometry, even one the cache has never heard of:
+    # changing one must miss the cache and write a new file for every grid
+    $BASE/run.sh -i ./mad_test.par coordinates/geometry_cache_dir=geometry_cache coordinates/cache_test_param=1 $2 >log_cache_${1}_third.txt 2>&1 || exit_code=$?
+    if [ $(ls geometry_cache/geometry_*.bin | wc -l) -ne $((2 * nfiles)) ]; then
+        echo "Geometry cache was reused after changing an unlisted coordinates parameter for ${1}"
+        exit_code=1
+    fi
+}
+
+check_lazy_coarse() {
+    # Under SMR, blocks construct coarse coordinates whose geometry is deferred by default.  Prolongation
+    # & restriction must never need it: results must be identical to building it up front
+    SMR="parthenon/mesh/refinement=static parthenon/mesh/numlevel=2 parthenon/static_refinement0/level=1
+         parthenon/static_refinement0/x1min=1.0 parthenon/static_refinement0/x1max=3.0
+         parthenon/static_refinement0/x2min=0.4 parthenon/static_refinement0/x2max=0.6
+         parthenon/static_refinement0/x3min=0.0 parthenon/static_refinement0/x3max=1.0
+         b_field/solver=face_ct b_field/ct_scheme=gs05_c"
+    $BASE/run.sh -i ./mad_test.par $SMR coordinates/lazy_coarse_geometry=true $2 >log_coarse_${1}_lazy.txt 2>&1 || exit_code=$?
+    mv torus.out0.final.phdf coarse_${1}_lazy.phdf
+    $BASE/run.sh -i ./mad_test.par $SMR coordinates/lazy_coarse_geometry=false $2 >log_coarse_${1}_eager.txt 2>&1 || exit_code=$?
+    mv torus.out0.final.phdf coarse_${1}_eager.phdf
+
+    pyharm diff --rel_tol 1e-14 coarse_${1}_lazy.phdf coarse_${1}_eager.phdf --no_plot || exit_code=$?
+}
+
 check_sanity imex driver/type=imex
 check_sanity harm driver/type=harm
 
+check_geometry_cache kharma driver/type=kharma
+check_lazy_coarse kharma driver/type=kharma
+check_table dcs "driver/type=kharma coordinates/base=dcs_ks coordinates/theory=dcs coordinates/zeta=0.1 coordinates/tabulate_metric=true"
+
 exit $exit_code